@@ -0,0 +1,187 @@
+#pragma once
+#include"Real/core.h"
+#include<cstddef>
+#include<span>
+
+/**
+* Accumulator is a compensated (Neumaier style) summation object for Real variables.
+*
+* Long reductions are the dominant error source in most numerical code: the plain
+* '+=' operator loses low order bits exactly where compare mode then flags them.
+* Accumulator keeps a running compensation term next to the sum, so the 'used' lane
+* accumulates with roughly the accuracy of a twice-as-wide type, while the 'exact'
+* lane (in the shadow carrying modes, Compare::Yes / Compare::Trap) keeps its usual
+* double accumulation - in Trap mode the registered handler is checked when the
+* result() is read. The bulk add()
+* overloads stripe the input over several independent compensated partial sums, which
+* both vectorizes and removes the loop carried dependency chain.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief compensated accumulator of Real variables
+    *
+    * @param {Precision, in} precision of 'used' type (either single or double; single by default)
+    * @param {Compare,   in} should an accuracy comparison be made between single & double precision? (no by default)
+    **/
+    template<Precision PRECISION = Precision::Single, Compare COMPARE = Compare::No> class Accumulator {
+
+        // aliases needed outside this class
+        public:
+            // alias for accumulated element
+            using REAL = Real<PRECISION, COMPARE>;
+
+            // alias for underlying type
+            using TYPE = typename REAL::TYPE;
+
+            // amount of independent partial sums used by the bulk paths
+            static constexpr std::size_t STRIPES = 8;
+
+        // properties
+        private:
+            TYPE m_sum{};           // running sum
+            TYPE m_compensation{};  // running compensation (Neumaier)
+            double m_exact{};       // 'exact' accumulation (comparison mode only; plain double sum)
+
+        // internal helpers
+        private:
+
+            // one compensated accumulation step into a given sum/compensation pair
+            static constexpr void step(TYPE& xio_sum, TYPE& xio_compensation, const TYPE xi_value) noexcept {
+                const TYPE t{ xio_sum + xi_value };
+                if (detail::bound_abs(xio_sum) >= detail::bound_abs(xi_value)) {
+                    xio_compensation += (xio_sum - t) + xi_value;
+                }
+                else {
+                    xio_compensation += (xi_value - t) + xio_sum;
+                }
+                xio_sum = t;
+            }
+
+        // modifiers
+        public:
+
+            // accumulate one value
+            constexpr void add(const REAL& xi_value) noexcept {
+                step(m_sum, m_compensation, xi_value.value());
+
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    m_exact += xi_value.exact();
+                }
+            }
+
+            constexpr void add(const TYPE xi_value) noexcept {
+                step(m_sum, m_compensation, xi_value);
+
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    m_exact += static_cast<double>(xi_value);
+                }
+            }
+
+            /**
+            * \brief accumulate a contiguous range of Real's, striped over several
+            *        independent compensated partial sums
+            *
+            * @param {Real*, in} first element
+            * @param {Real*, in} one past the last element
+            **/
+            void add(const REAL* xi_first, const REAL* const xi_last) noexcept {
+                TYPE sums[STRIPES]{};
+                TYPE compensations[STRIPES]{};
+                double exacts[STRIPES]{};
+
+                const REAL* it{ xi_first };
+                while ((xi_last - it) >= static_cast<std::ptrdiff_t>(STRIPES)) {
+                    for (std::size_t s{}; s < STRIPES; ++s) {
+                        step(sums[s], compensations[s], it[s].value());
+                    }
+
+                    if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                        for (std::size_t s{}; s < STRIPES; ++s) {
+                            exacts[s] += it[s].exact();
+                        }
+                    }
+
+                    it += STRIPES;
+                }
+
+                for (std::size_t s{}; s < STRIPES; ++s) {
+                    step(m_sum, m_compensation, sums[s]);
+                    step(m_sum, m_compensation, compensations[s]);
+
+                    if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                        m_exact += exacts[s];
+                    }
+                }
+
+                // remaining tail
+                for (; it != xi_last; ++it) {
+                    add(*it);
+                }
+            }
+
+            /**
+            * \brief accumulate a contiguous plane of raw values (e.g. - RealArray's values());
+            *        in comparison mode the 'exact' lane is fed from the same values
+            *
+            * @param {span, in} values to accumulate
+            **/
+            void add(const std::span<const TYPE> xi_values) noexcept {
+                TYPE sums[STRIPES]{};
+                TYPE compensations[STRIPES]{};
+                double exacts[STRIPES]{};
+
+                std::size_t i{};
+                const std::size_t size{ xi_values.size() };
+                for (; (i + STRIPES) <= size; i += STRIPES) {
+                    for (std::size_t s{}; s < STRIPES; ++s) {
+                        step(sums[s], compensations[s], xi_values[i + s]);
+                    }
+
+                    if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                        for (std::size_t s{}; s < STRIPES; ++s) {
+                            exacts[s] += static_cast<double>(xi_values[i + s]);
+                        }
+                    }
+                }
+
+                for (std::size_t s{}; s < STRIPES; ++s) {
+                    step(m_sum, m_compensation, sums[s]);
+                    step(m_sum, m_compensation, compensations[s]);
+
+                    if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                        m_exact += exacts[s];
+                    }
+                }
+
+                for (; i < size; ++i) {
+                    add(xi_values[i]);
+                }
+            }
+
+            // reset the accumulator
+            constexpr void reset() noexcept {
+                m_sum          = TYPE(0);
+                m_compensation = TYPE(0);
+                m_exact        = 0.0;
+            }
+
+        // getters
+        public:
+
+            // return the compensated sum (in Trap mode, against the registered threshold)
+            constexpr REAL result() const noexcept {
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    if constexpr (COMPARE == Compare::Trap) {
+                        Trap::check<PRECISION>(static_cast<double>(m_sum + m_compensation), m_exact);
+                    }
+                    return REAL(m_sum + m_compensation, m_exact);
+                }
+                else {
+                    return REAL(m_sum + m_compensation);
+                }
+            }
+    };
+};
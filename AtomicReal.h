@@ -0,0 +1,206 @@
+#pragma once
+#include"Real/core.h"
+#include<atomic>
+
+/**
+* AtomicReal is a lock-free accumulation cell for Real variables, so parallel
+* reductions no longer funnel through a mutex guarded Real.
+*
+* The 'used' lane (and, in comparison mode, the 'exact' lane) is a std::atomic of
+* the lane type; fetch_add/fetch_sub run a compare-exchange loop per lane, which on
+* current hardware is a handful of instructions and scales across cores. The lanes
+* are INDEPENDENTLY atomic: each lane individually observes every added value
+* exactly once (so after all writers join, both the sum and its exact shadow are
+* complete and the error() is meaningful), but a concurrent load() may pair a
+* 'used' lane that already includes a contribution with an 'exact' lane that does
+* not yet. Read the cell after the writers are done - which is how a reduction is
+* consumed anyway - and this tearing is unobservable.
+*
+* Note: floating point accumulation is not associative, so the sum of a parallel
+* reduction may differ from the serial one by the usual reordering rounding; the
+* 'exact' lane is reordered the same way.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief lock-free accumulation cell of a Real variable
+    *
+    * @param {Precision, in} precision of 'used' type (either single or double; single by default)
+    * @param {Compare,   in} should an accuracy comparison be made between single & double precision? (no by default)
+    **/
+    template<Precision PRECISION = Precision::Single, Compare COMPARE = Compare::No> class AtomicReal {
+        static_assert((COMPARE == Compare::No) || (COMPARE == Compare::Yes),
+                      "AtomicReal: only Compare::No / Compare::Yes are supported - Bound and Interval keep lanes whose update depends on the value lane, so the pair can not be updated as one atomic step; Deferred records onto a thread local tape; Stochastic must perturb every operation, which a plain atomic add would skip.");
+
+        // aliases needed outside this class
+        public:
+            // alias for the accumulated element
+            using REAL = Real<PRECISION, COMPARE>;
+
+            // alias for underlying type
+            using TYPE = typename REAL::TYPE;
+
+        // internal lane layout
+        private:
+
+            // atomic lanes of a non comparison variable
+            struct atomicRegularStruct {
+                std::atomic<TYPE> _value{};     // 'used' lane
+            };
+
+            // atomic lanes of a comparison variable
+            struct atomicCompareStruct {
+                std::atomic<TYPE> _value{};     // 'used' lane
+                std::atomic<double> _exact{};   // 'exact' lane
+            };
+
+            // alias for functional lane layout
+            using PROPERTY_TYPE = typename std::conditional<COMPARE == Compare::Yes, atomicCompareStruct, atomicRegularStruct>::type;
+
+            // atomic lanes
+            PROPERTY_TYPE m_value;
+
+        // internal helpers
+        private:
+
+            // atomically add 'xi_value' into one lane, returning the lane's previous value
+            // (a compare-exchange loop rather than std::atomic::fetch_add, since the latter
+            //  only exists for float/double/long double and the 16bit lanes need it too)
+            template<typename T> static T cas_add(std::atomic<T>& xio_lane, const T xi_value) noexcept {
+                T old{ xio_lane.load(std::memory_order_relaxed) };
+                while (!xio_lane.compare_exchange_weak(old, static_cast<T>(old + xi_value), std::memory_order_relaxed)) {}
+                return old;
+            }
+
+        // constructor
+        public:
+
+            constexpr AtomicReal() = default;
+
+            AtomicReal(const TYPE v) {
+                m_value._value.store(v, std::memory_order_relaxed);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_value._exact.store(static_cast<double>(v), std::memory_order_relaxed);
+                }
+            }
+
+            AtomicReal(const REAL& r) {
+                m_value._value.store(r.value(), std::memory_order_relaxed);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_value._exact.store(r.exact(), std::memory_order_relaxed);
+                }
+            }
+
+            // an atomic cell is pinned in memory
+            AtomicReal(const AtomicReal&)            = delete;
+            AtomicReal& operator=(const AtomicReal&) = delete;
+
+        // modifiers
+        public:
+
+            /**
+            * \brief atomically add a value, returning the cell's previous value
+            *        (per lane; see the header note on cross-lane tearing)
+            *
+            * @param {Real/TYPE, in}  value to add
+            * @param {Real,      out} value held just before this addition
+            **/
+            REAL fetch_add(const REAL& xi_value) noexcept {
+                const TYPE old{ cas_add(m_value._value, xi_value.value()) };
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(old, cas_add(m_value._exact, xi_value.exact()));
+                }
+                else {
+                    return REAL(old);
+                }
+            }
+
+            REAL fetch_add(const TYPE xi_value) noexcept {
+                const TYPE old{ cas_add(m_value._value, xi_value) };
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(old, cas_add(m_value._exact, static_cast<double>(xi_value)));
+                }
+                else {
+                    return REAL(old);
+                }
+            }
+
+            // atomically subtract a value, returning the cell's previous value
+            REAL fetch_sub(const REAL& xi_value) noexcept {
+                const TYPE old{ cas_add(m_value._value, static_cast<TYPE>(-xi_value.value())) };
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(old, cas_add(m_value._exact, -xi_value.exact()));
+                }
+                else {
+                    return REAL(old);
+                }
+            }
+
+            REAL fetch_sub(const TYPE xi_value) noexcept {
+                const TYPE old{ cas_add(m_value._value, static_cast<TYPE>(-xi_value)) };
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(old, cas_add(m_value._exact, -static_cast<double>(xi_value)));
+                }
+                else {
+                    return REAL(old);
+                }
+            }
+
+            // accumulation operators (discarding the previous value)
+            AtomicReal& operator += (const REAL& xi_value) noexcept { fetch_add(xi_value); return *this; }
+            AtomicReal& operator += (const TYPE xi_value)  noexcept { fetch_add(xi_value); return *this; }
+            AtomicReal& operator -= (const REAL& xi_value) noexcept { fetch_sub(xi_value); return *this; }
+            AtomicReal& operator -= (const TYPE xi_value)  noexcept { fetch_sub(xi_value); return *this; }
+
+            // store a value (per lane)
+            void store(const REAL& xi_value) noexcept {
+                m_value._value.store(xi_value.value());
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_value._exact.store(xi_value.exact());
+                }
+            }
+
+        // getters
+        public:
+
+            // load the held value (per lane; see the header note on cross-lane tearing)
+            REAL load() const noexcept {
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(m_value._value.load(), m_value._exact.load());
+                }
+                else {
+                    return REAL(m_value._value.load());
+                }
+            }
+
+            // return the 'used' lane
+            TYPE value() const noexcept { return m_value._value.load(); }
+
+            // return the 'exact' lane
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            double exact() const noexcept { return m_value._exact.load(); }
+
+            // return the error between the 'exact' and 'used' lanes
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            double error() const noexcept { return (exact() - static_cast<double>(value())); }
+
+            // is every lane lock-free on this target?
+            bool is_lock_free() const noexcept {
+                if constexpr (COMPARE == Compare::Yes) {
+                    return (m_value._value.is_lock_free() && m_value._exact.is_lock_free());
+                }
+                else {
+                    return m_value._value.is_lock_free();
+                }
+            }
+    };
+};
@@ -0,0 +1,242 @@
+#pragma once
+#include"Real/core.h"
+#include<atomic>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<iostream>
+#include<string>
+#include<unordered_map>
+
+/**
+* Audit turns "which of these fields do I promote to Real<Double>" from a guess
+* into a measurement. Wrap a compare-mode Real member in FP::Tracked and give it
+* a runtime name: every mutating operation then attributes the magnitude of its
+* error change to that name, and Audit::dump() prints the fields ranked by
+* accumulated error growth per byte of 'used' lane - the fields at the top are
+* the ones worth widening, the rest stay narrow and keep the memory bandwidth
+* win of Real<Single>.
+*
+* Attribution is per thread (same scheme as ErrorReport.h): each thread
+* accumulates into its own buckets, exited threads publish onto a lock-free
+* list, and dump() merges the lot. Construct a Tracked on the thread that
+* mutates it.
+*
+* Usage:
+*   struct State {
+*       FP::Tracked<FP::Real<FP::Precision::Single, FP::Compare::Yes>> _position{ "position" };
+*       FP::Tracked<FP::Real<FP::Precision::Single, FP::Compare::Yes>> _velocity{ "velocity" };
+*   };
+*   ... simulate ...
+*   FP::Audit::dump();
+*
+* Dan Israel Malta
+**/
+namespace FP {
+    namespace Audit {
+
+        /**
+        * \brief accumulated error attribution of one named field
+        **/
+        struct Statistics {
+            // properties
+            std::uint64_t _count{};         // amount of recorded mutations
+            double _sum{};                  // accumulated |error change| over all mutations
+            double _max{};                  // largest single |error change|
+            std::size_t _lane_bytes{};      // size of the field's 'used' lane [bytes]
+
+            // record one mutation's error change
+            void add(const double xi_growth) noexcept {
+                ++_count;
+                _sum += xi_growth;
+                if (xi_growth > _max) {
+                    _max = xi_growth;
+                }
+            }
+
+            // merge another thread's statistics of the same field into this one
+            void merge(const Statistics& xi_other) noexcept {
+                _count += xi_other._count;
+                _sum   += xi_other._sum;
+                if (xi_other._max > _max) {
+                    _max = xi_other._max;
+                }
+                if (xi_other._lane_bytes > _lane_bytes) {
+                    _lane_bytes = xi_other._lane_bytes;
+                }
+            }
+
+            // the ranking metric: accumulated error growth per byte of 'used' lane
+            double per_byte() const noexcept {
+                return ((_lane_bytes > 0) ? (_sum / static_cast<double>(_lane_bytes)) : _sum);
+            }
+        };
+
+        // internal machinery
+        namespace detail {
+
+            // node of the global (lock-free, push only) list of exited threads' aggregates
+            struct Node {
+                std::string _name;      // field name
+                Statistics _stats;      // its accumulated attribution
+                Node* _next;
+            };
+
+            inline std::atomic<Node*>& head() noexcept {
+                static std::atomic<Node*> s_head{ nullptr };
+                return s_head;
+            }
+
+            inline void publish(std::string&& xi_name, const Statistics& xi_stats) {
+                Node* node{ new Node{ std::move(xi_name), xi_stats, nullptr } };
+                Node* old{ head().load(std::memory_order_relaxed) };
+                do {
+                    node->_next = old;
+                } while (!head().compare_exchange_weak(old, node, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            // per-thread registry; merged into the global list on thread exit
+            struct ThreadRegistry {
+                std::unordered_map<std::string, Statistics> _fields;
+
+                ~ThreadRegistry() {
+                    for (auto& field : _fields) {
+                        publish(std::string(field.first), field.second);
+                    }
+                }
+            };
+
+            inline ThreadRegistry& registry() {
+                thread_local ThreadRegistry s_registry;
+                return s_registry;
+            }
+        }
+
+        /**
+        * \brief the calling thread's bucket of one named field (creating it on
+        *        first use; Tracked resolves its bucket once, at construction)
+        *
+        * @param {string, in} field name
+        * @param {size_t, in} size of the field's 'used' lane [bytes]
+        * @param {Statistics, out} the field's bucket on this thread
+        **/
+        inline Statistics& field(const std::string& xi_name, const std::size_t xi_lane_bytes) {
+            Statistics& stats{ detail::registry()._fields[xi_name] };
+            stats._lane_bytes = xi_lane_bytes;
+            return stats;
+        }
+
+        /**
+        * \brief print the merged per-field attribution, ranked by accumulated
+        *        error growth per byte of 'used' lane (the promotion shortlist
+        *        reads top to bottom)
+        *
+        * @param {ostream, in/out} stream to print into (std::cout by default)
+        **/
+        inline void dump(std::ostream& xio_stream = std::cout) {
+            std::unordered_map<std::string, Statistics> merged;
+
+            for (detail::Node* node{ detail::head().load(std::memory_order_acquire) }; node != nullptr; node = node->_next) {
+                merged[node->_name].merge(node->_stats);
+            }
+            for (const auto& field : detail::registry()._fields) {
+                merged[field.first].merge(field.second);
+            }
+
+            while (!merged.empty()) {
+                auto worst{ merged.begin() };
+                for (auto it{ merged.begin() }; it != merged.end(); ++it) {
+                    if (it->second.per_byte() > worst->second.per_byte()) {
+                        worst = it;
+                    }
+                }
+
+                const Statistics& stats{ worst->second };
+                xio_stream << worst->first
+                           << ": growth/byte = " << stats.per_byte()
+                           << ", accumulated growth = " << stats._sum
+                           << ", max growth = " << stats._max
+                           << ", mutations = " << stats._count
+                           << ", lane = " << stats._lane_bytes << " bytes\n";
+                merged.erase(worst);
+            }
+        }
+    }
+
+    /**
+    * \brief a named, audited Real: behaves as the wrapped Real in expressions
+    *        (implicit conversion) and attributes every mutation's error change
+    *        to its name in the Audit registry.
+    *
+    * @param {REAL, in} the wrapped Real type (must carry an 'exact' shadow -
+    *                   Compare::Yes or Compare::Trap)
+    **/
+    template<typename REAL> class Tracked {
+        static_assert(detail::operand_traits<REAL>::is_real &&
+                      ((detail::operand_traits<REAL>::compare == Compare::Yes) ||
+                       (detail::operand_traits<REAL>::compare == Compare::Trap)),
+                      "Tracked: requires a Real carrying an 'exact' shadow (Compare::Yes / Compare::Trap).");
+
+        // properties
+        private:
+            REAL m_value;                   // the audited value
+            Audit::Statistics* m_stats;     // its attribution bucket (this thread's)
+
+            // attribute the mutation that moved the error from xi_before
+            void observe(const double xi_before) noexcept {
+                m_stats->add(std::fabs(m_value.error() - xi_before));
+            }
+
+        // constructor
+        public:
+            explicit Tracked(const char* xi_name, const REAL& xi_value = REAL()) :
+                m_value(xi_value), m_stats(&Audit::field(xi_name, sizeof(typename REAL::TYPE))) {}
+
+        // getters
+        public:
+            constexpr const REAL& get() const noexcept { return m_value; }
+            constexpr operator const REAL&() const noexcept { return m_value; }
+
+            constexpr auto value() const noexcept { return m_value.value(); }
+            constexpr double exact() const noexcept { return m_value.exact(); }
+            constexpr double error() const noexcept { return m_value.error(); }
+
+        // assignment (scalar, Real or expression; attributed)
+        public:
+            template<typename T> Tracked& operator=(const T& xi_value) {
+                const double before{ m_value.error() };
+                m_value = xi_value;
+                observe(before);
+                return *this;
+            }
+
+        // numerical assignment operator overloading (attributed)
+        public:
+
+#define M_TRACKED_OPERATOR(OP)                                                 \
+            template<typename T> Tracked& operator OP(const T& xi_value) {     \
+                const double before{ m_value.error() };                        \
+                m_value OP xi_value;                                           \
+                observe(before);                                               \
+                return *this;                                                  \
+            }
+
+            M_TRACKED_OPERATOR(+=);
+            M_TRACKED_OPERATOR(-=);
+            M_TRACKED_OPERATOR(*=);
+            M_TRACKED_OPERATOR(/=);
+
+#undef M_TRACKED_OPERATOR
+    };
+
+    // a Tracked participates in the expression machinery exactly as its wrapped
+    // Real (the machinery only touches value()/exact(), which Tracked forwards)
+    namespace detail {
+        template<typename REAL> struct operand_traits<Tracked<REAL>> {
+            static constexpr bool is_real{ true };
+            static constexpr bool is_scalar{ false };
+            static constexpr Precision precision{ operand_traits<REAL>::precision };
+            static constexpr Compare compare{ operand_traits<REAL>::compare };
+        };
+    }
+};
@@ -0,0 +1,106 @@
+#pragma once
+#include"Real/math.h"
+#include"Real/traits.h"
+#include<cstddef>
+#include<span>
+
+/**
+* BatchMath gives every scalar math function of Real a span-level counterpart,
+* plus a fused per-element pipeline:
+*
+* > FP::exp(in, out) / FP::sin(in, out) / ...   - apply one function over a whole
+*   buffer. the kernel is a single tight loop over contiguous elements, so the
+*   compiler can unroll and (with a vector math library such as libmvec) vectorize
+*   it, instead of paying a full libm call setup per element at every call site.
+* > FP::transform(in, out, operation)           - apply a composed per-element
+*   operation in ONE pass. a chain of span kernels reads and writes the buffer
+*   once per stage; transform fuses the stages, so a pipeline such as
+*   "log(abs(x)) * 0.5" touches memory once instead of three times. the operation
+*   may return a Real or a lazy expression - assignment materializes it per lane.
+*
+* Both spans must view the same Real type; the kernels process the smaller of the
+* two extents.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // --- span-level unary numerical functions ---
+#define M_BATCH_UNARY_FUNCTION(NAME)                                                                                      \
+    template<typename REAL_IN, typename REAL_OUT>                                                                         \
+    inline void NAME(const std::span<REAL_IN> xi_in, const std::span<REAL_OUT> xio_out) noexcept {                        \
+        static_assert(is_real_v<REAL_OUT>, "FP::" #NAME "(in, out): output span must hold Real's");                       \
+        static_assert(std::is_same_v<std::remove_const_t<REAL_IN>, REAL_OUT>,                                             \
+                      "FP::" #NAME "(in, out): both spans must hold the same Real type");                                 \
+        const std::size_t len{ (xi_in.size() < xio_out.size()) ? xi_in.size() : xio_out.size() };                         \
+        for (std::size_t i{}; i < len; ++i) {                                                                             \
+            xio_out[i] = NAME(xi_in[i]);                                                                                  \
+        }                                                                                                                 \
+    }
+    M_BATCH_UNARY_FUNCTION(abs);
+    M_BATCH_UNARY_FUNCTION(floor);
+    M_BATCH_UNARY_FUNCTION(ceil);
+    M_BATCH_UNARY_FUNCTION(round);
+    M_BATCH_UNARY_FUNCTION(rint);
+    M_BATCH_UNARY_FUNCTION(trunc);
+    M_BATCH_UNARY_FUNCTION(sqrt);
+    M_BATCH_UNARY_FUNCTION(cbrt);
+    M_BATCH_UNARY_FUNCTION(exp);
+    M_BATCH_UNARY_FUNCTION(exp2);
+    M_BATCH_UNARY_FUNCTION(log);
+    M_BATCH_UNARY_FUNCTION(log2);
+    M_BATCH_UNARY_FUNCTION(log10);
+    M_BATCH_UNARY_FUNCTION(log1p);
+    M_BATCH_UNARY_FUNCTION(sin);
+    M_BATCH_UNARY_FUNCTION(cos);
+    M_BATCH_UNARY_FUNCTION(tan);
+    M_BATCH_UNARY_FUNCTION(asin);
+    M_BATCH_UNARY_FUNCTION(acos);
+    M_BATCH_UNARY_FUNCTION(atan);
+    M_BATCH_UNARY_FUNCTION(sinh);
+    M_BATCH_UNARY_FUNCTION(cosh);
+    M_BATCH_UNARY_FUNCTION(tanh);
+    M_BATCH_UNARY_FUNCTION(asinh);
+    M_BATCH_UNARY_FUNCTION(acosh);
+    M_BATCH_UNARY_FUNCTION(atanh);
+    M_BATCH_UNARY_FUNCTION(erf);
+    M_BATCH_UNARY_FUNCTION(erfc);
+    M_BATCH_UNARY_FUNCTION(tgamma);
+    M_BATCH_UNARY_FUNCTION(lgamma);
+
+#undef M_BATCH_UNARY_FUNCTION
+
+    /**
+    * \brief apply a composed per-element operation over a span, in one pass
+    *
+    * @param {span,      in}  input elements
+    * @param {span,      out} per-element operation results (may alias the input)
+    * @param {callable,  in}  operation over one element; may return a Real or a
+    *                         lazy expression (materialized on assignment)
+    **/
+    template<typename REAL_IN, typename REAL_OUT, typename OPERATION>
+    inline void transform(const std::span<REAL_IN> xi_in, const std::span<REAL_OUT> xio_out, OPERATION&& xi_operation) {
+        static_assert(is_real_v<REAL_OUT>, "FP::transform(in, out, operation): output span must hold Real's");
+        static_assert(is_real_v<std::remove_const_t<REAL_IN>>, "FP::transform(in, out, operation): input span must hold Real's");
+
+        const std::size_t len{ (xi_in.size() < xio_out.size()) ? xi_in.size() : xio_out.size() };
+        for (std::size_t i{}; i < len; ++i) {
+            xio_out[i] = xi_operation(xi_in[i]);
+        }
+    }
+
+    /**
+    * \brief apply a composed per-element operation over a span, in place
+    *
+    * @param {span,     in|out} elements, transformed in place
+    * @param {callable, in}     operation over one element (Real or lazy expression)
+    **/
+    template<typename REAL, typename OPERATION>
+    inline void transform(const std::span<REAL> xio_values, OPERATION&& xi_operation) {
+        static_assert(is_real_v<REAL>, "FP::transform(values, operation): span must hold Real's");
+
+        for (std::size_t i{}; i < xio_values.size(); ++i) {
+            xio_values[i] = xi_operation(xio_values[i]);
+        }
+    }
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include"Real/core.h"
+#include"Real/traits.h"
+#include<cstddef>
+#include<span>
+
+/**
+* Convert moves whole buffers between Real instantiations (and raw scalar
+* planes) in one tight, vectorizable loop: FP::convert(src_span, dst_span).
+*
+* The interesting path is demote-but-keep-shadow: converting a Real<Double>
+* (or raw double) buffer into Real<Single, Compare::Yes> stores the narrowed
+* float as the 'used' lane and the original double as the 'exact' lane, so a
+* precision experiment over a multi-GB solver buffer is one call - and error()
+* then measures exactly what the demotion cost, element by element. The
+* reverse direction, shadow-carrying to plain, simply drops the extra lanes.
+*
+* Lane rules per destination mode: a shadow-carrying destination (Yes / Trap)
+* takes the source's 'exact' lane when it has one, else the source value
+* widened to double; any other cross-mode destination restarts its tracking at
+* the converted value (same behaviour as constructing it from a scalar). When
+* source and destination share a comparison mode, the element-wise converting
+* constructors apply - including the Bound and Interval narrowing rules.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // internal machinery
+    namespace detail {
+
+        // the best available double image of one source element
+        template<typename SRC> constexpr double convert_exact_of(const SRC& xi_source) noexcept {
+            if constexpr (std::is_arithmetic<SRC>::value) {
+                return static_cast<double>(xi_source);
+            }
+            else if constexpr ((operand_traits<SRC>::compare == Compare::Yes) || (operand_traits<SRC>::compare == Compare::Trap)) {
+                return xi_source.exact();
+            }
+            else {
+                return static_cast<double>(xi_source.value());
+            }
+        }
+
+        // convert one element
+        template<typename DST, typename SRC> constexpr DST convert_one(const SRC& xi_source) noexcept {
+            if constexpr (std::is_arithmetic<DST>::value) {         // Real/scalar -> raw scalar plane
+                if constexpr (std::is_arithmetic<SRC>::value) {
+                    return static_cast<DST>(xi_source);
+                }
+                else {
+                    return static_cast<DST>(xi_source.value());
+                }
+            }
+            else if constexpr (std::is_arithmetic<SRC>::value) {    // raw scalar plane -> Real
+                using TYPE = typename DST::TYPE;
+                if constexpr ((operand_traits<DST>::compare == Compare::Yes) || (operand_traits<DST>::compare == Compare::Trap)) {
+                    return DST(static_cast<TYPE>(xi_source), static_cast<double>(xi_source));
+                }
+                else {
+                    return DST(static_cast<TYPE>(xi_source));
+                }
+            }
+            else if constexpr (operand_traits<SRC>::compare == operand_traits<DST>::compare) {
+                if constexpr (operand_traits<SRC>::precision == operand_traits<DST>::precision) {
+                    return xi_source;
+                }
+                else {                                              // converting constructor carries the mode's lanes
+                    return DST(xi_source);
+                }
+            }
+            else {                                                  // cross-mode
+                using TYPE = typename DST::TYPE;
+                if constexpr ((operand_traits<DST>::compare == Compare::Yes) || (operand_traits<DST>::compare == Compare::Trap)) {
+                    return DST(static_cast<TYPE>(xi_source.value()), convert_exact_of(xi_source));
+                }
+                else {
+                    return DST(static_cast<TYPE>(xi_source.value()));
+                }
+            }
+        }
+    }
+
+    /**
+    * \brief convert a buffer of Real's/scalars into a buffer of another Real
+    *        instantiation (or raw scalar plane), element by element, in one pass
+    *
+    * @param {span, in}  source elements (Real's of any instantiation, or scalars)
+    * @param {span, out} converted elements (the smaller extent is processed)
+    **/
+    template<typename SRC, typename DST> inline void convert(const std::span<SRC> xi_source, const std::span<DST> xio_destination) noexcept {
+        using SOURCE = std::remove_const_t<SRC>;
+        static_assert(is_real_v<SOURCE> || std::is_arithmetic<SOURCE>::value, "FP::convert: source span must hold Real's or scalars");
+        static_assert(is_real_v<DST> || std::is_arithmetic<DST>::value, "FP::convert: destination span must hold Real's or scalars");
+
+        const std::size_t len{ (xi_source.size() < xio_destination.size()) ? xi_source.size() : xio_destination.size() };
+        for (std::size_t i{}; i < len; ++i) {
+            xio_destination[i] = detail::convert_one<DST>(xi_source[i]);
+        }
+    }
+};
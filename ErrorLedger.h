@@ -0,0 +1,406 @@
+#pragma once
+#include"Real/core.h"
+#include<atomic>
+#include<chrono>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<limits>
+#include<cstring>
+#include<memory>
+#include<source_location>
+#include<thread>
+#include<unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FP_REAL_HAS_LEDGER
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+/**
+* ErrorLedger streams per-operation error observations to disk while the run is
+* still hot, so long jobs can be audited offline instead of re-run under
+* instrumentation.
+*
+* The writer side is built for the hot path: Ledger::Writer::append() stamps a
+* fixed size 32 byte record (timestamp, callsite id, value, error) and pushes it
+* into a bounded lock-free ring (Vyukov sequence scheme; any thread may append,
+* a full ring drops the record and counts the drop - the hot path never blocks
+* on the disk). A background thread drains the ring into a memory mapped file,
+* growing the mapping in 4MB windows, so persisting a record is a memcpy into
+* the page cache. The record size divides the page size, so records never
+* straddle a mapping window and the file needs no framing.
+*
+* The reader side scans the ledger back through the same mmap: Ledger::scan()
+* hands every record to a visitor, Ledger::summarize() aggregates per-callsite
+* statistics (count / mean / max |error|, first and last timestamp) in the
+* style of ErrorReport's profile. The format is the in-memory record layout
+* behind a small header - like Serialize.h checkpoints, it is portable across
+* builds which agree on endianness, which is the intended offline-analysis use.
+*
+* Usage:
+*   { FP::Ledger::Writer ledger("run.ledger");
+*     ... ledger.append(FP::Ledger::site(), r); ... }   // any thread
+*   for (auto& [site, stats] : FP::Ledger::summarize("run.ledger")) { ... }
+*
+* Dan Israel Malta
+**/
+namespace FP {
+#if defined(FP_REAL_HAS_LEDGER)
+    namespace Ledger {
+
+        /**
+        * \brief one ledger entry (fixed size, trivially copyable - the file is a
+        *        header followed by these, back to back)
+        **/
+        struct Record {
+            std::uint64_t _nanoseconds;     // steady clock timestamp [ns since epoch of std::chrono::steady_clock]
+            std::uint32_t _site;            // callsite id (see Ledger::site())
+            std::uint32_t _reserved;        // keeps the doubles aligned; zero
+            double _value;                  // 'used' lane value, widened to double
+            double _error;                  // running error (exact - value)
+        };
+        static_assert((sizeof(Record) == 32) && std::is_trivially_copyable<Record>::value, "Ledger::Record must remain a packed 32 byte POD - it is the file format.");
+
+        /**
+        * \brief the file's leading header
+        **/
+        struct Header {
+            std::uint32_t _magic;           // 'FPLG'
+            std::uint32_t _version;         // format version (1)
+            std::uint32_t _record_bytes;    // sizeof(Record) of the writing build
+            std::uint32_t _reserved;        // zero
+            std::uint64_t _dropped;         // records lost to a full ring (written at close)
+            std::uint64_t _reserved2;       // zero
+        };
+        static_assert(sizeof(Header) == sizeof(Record), "Ledger::Header must match the record stride.");
+
+        // the expected magic/version
+        constexpr std::uint32_t MAGIC{ 0x464C5047 };
+        constexpr std::uint32_t VERSION{ 1 };
+
+        /**
+        * \brief a stable callsite id - FNV-1a over file name and line (call with no
+        *        argument to id the calling line)
+        *
+        * @param {source_location, in}  callsite (defaulted to the caller)
+        * @param {uint32_t,        out} its id
+        **/
+        inline std::uint32_t site(const std::source_location xi_location = std::source_location::current()) noexcept {
+            std::uint32_t hash{ UINT32_C(2166136261) };
+            for (const char* c{ xi_location.file_name() }; *c != '\0'; ++c) {
+                hash = (hash ^ static_cast<std::uint32_t>(*c)) * UINT32_C(16777619);
+            }
+            hash = (hash ^ xi_location.line()) * UINT32_C(16777619);
+            return hash;
+        }
+
+        /**
+        * \brief the streaming writer: a bounded lock-free ring (any thread appends)
+        *        drained into a memory mapped file by a background thread. records
+        *        offered to a full ring are dropped and counted, never waited on;
+        *        the drop count lands in the file header at close.
+        **/
+        class Writer {
+
+            // constants
+            private:
+                static constexpr std::size_t RING_SIZE{ std::size_t(1) << 16 };             // ring capacity [records]; power of two
+                static constexpr std::size_t RING_MASK{ RING_SIZE - 1 };
+                static constexpr std::size_t WINDOW_BYTES{ std::size_t(1) << 22 };          // mapping window [bytes]; page multiple
+
+                // one ring slot (Vyukov sequence scheme: _sequence == position means
+                // "free", == position + 1 means "holds the record enqueued there")
+                struct Slot {
+                    std::atomic<std::uint64_t> _sequence;
+                    Record _record;
+                };
+
+            // properties
+            private:
+                std::unique_ptr<Slot[]> m_ring;         // the ring's slots
+                std::atomic<std::uint64_t> m_tail{};    // next position producers claim
+                std::uint64_t m_head{};                 // next position to drain (drain thread only)
+                std::atomic<std::uint64_t> m_dropped{}; // records lost to a full ring
+                std::atomic<bool> m_stop{ false };      // shutdown flag for the drain thread
+
+                int m_fd{ -1 };                         // the ledger file (-1 when the open failed)
+                std::byte* m_window{ nullptr };         // current mapping window
+                std::size_t m_window_first{};           // file offset of the window's first byte
+                std::size_t m_file_bytes{};             // bytes persisted so far (header included)
+                std::thread m_drain;                    // the draining thread
+
+            // constructor
+            public:
+
+                explicit Writer(const char* const xi_path) : m_ring(new Slot[RING_SIZE]) {
+                    for (std::size_t i{}; i < RING_SIZE; ++i) {
+                        m_ring[i]._sequence.store(i, std::memory_order_relaxed);
+                    }
+
+                    m_fd = ::open(xi_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+                    if ((m_fd >= 0) && !map_window(0)) {
+                        ::close(m_fd);
+                        m_fd = -1;
+                    }
+                    if (m_fd < 0) {
+                        return;
+                    }
+
+                    const Header header{ MAGIC, VERSION, static_cast<std::uint32_t>(sizeof(Record)), 0, 0, 0 };
+                    std::memcpy(m_window, &header, sizeof(Header));
+                    m_file_bytes = sizeof(Header);
+
+                    m_drain = std::thread([this]() { drain(); });
+                }
+
+                ~Writer() { close(); }
+
+                // one writer per ledger
+                Writer(const Writer&)            = delete;
+                Writer& operator=(const Writer&) = delete;
+
+            // getters
+            public:
+
+                // was the ledger file opened and mapped successfully?
+                bool valid() const noexcept { return (m_fd >= 0); }
+
+                // records lost so far to a full ring
+                std::uint64_t dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+            // record appending (the hot path; any thread)
+            public:
+
+                /**
+                * \brief append one observation (timestamped here)
+                *
+                * @param {uint32_t, in}  callsite id
+                * @param {double,   in}  value
+                * @param {double,   in}  error (exact - value)
+                * @param {bool,     out} false if the writer is invalid or the ring was full
+                **/
+                bool append(const std::uint32_t xi_site, const double xi_value, const double xi_error) noexcept {
+                    if (m_fd < 0) {
+                        return false;
+                    }
+
+                    const std::uint64_t now{ static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) };
+                    std::uint64_t tail{ m_tail.load(std::memory_order_relaxed) };
+                    for (;;) {
+                        Slot& slot{ m_ring[tail & RING_MASK] };
+                        const std::int64_t delta{ static_cast<std::int64_t>(slot._sequence.load(std::memory_order_acquire)) - static_cast<std::int64_t>(tail) };
+                        if (delta == 0) {
+                            if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                                slot._record = Record{ now, xi_site, 0, xi_value, xi_error };
+                                slot._sequence.store(tail + 1, std::memory_order_release);
+                                return true;
+                            }
+                        }
+                        else if (delta < 0) {   // ring full - drop, never stall the caller
+                            m_dropped.fetch_add(1, std::memory_order_relaxed);
+                            return false;
+                        }
+                        else {                  // another producer claimed this slot
+                            tail = m_tail.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                /**
+                * \brief append one shadow-carrying Real's current value and error
+                *
+                * @param {uint32_t, in}  callsite id
+                * @param {Real,     in}  observed value (Compare::Yes / Compare::Trap)
+                * @param {bool,     out} false if the writer is invalid or the ring was full
+                **/
+                template<Precision PRECISION, Compare COMPARE> bool append(const std::uint32_t xi_site, const Real<PRECISION, COMPARE>& xi_value) noexcept {
+                    static_assert((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap), "Ledger::Writer::append: requires a Real carrying an 'exact' shadow (Compare::Yes / Compare::Trap).");
+                    return append(xi_site, static_cast<double>(xi_value.value()), xi_value.error());
+                }
+
+            // shutdown
+            public:
+
+                /**
+                * \brief drain the remaining records, stamp the drop count into the
+                *        header, trim the file to its exact size and close it (also
+                *        performed by the destructor; safe to call twice)
+                **/
+                void close() noexcept {
+                    if (m_fd < 0) {
+                        return;
+                    }
+
+                    m_stop.store(true, std::memory_order_release);
+                    if (m_drain.joinable()) {
+                        m_drain.join();     // the drain thread empties the ring before exiting
+                    }
+
+                    Header header{ MAGIC, VERSION, static_cast<std::uint32_t>(sizeof(Record)), 0, m_dropped.load(std::memory_order_relaxed), 0 };
+                    ::pwrite(m_fd, &header, sizeof(Header), 0);
+
+                    ::munmap(m_window, WINDOW_BYTES);
+                    m_window = nullptr;
+                    [[maybe_unused]] const int trimmed{ ::ftruncate(m_fd, static_cast<off_t>(m_file_bytes)) };
+                    ::close(m_fd);
+                    m_fd = -1;
+                }
+
+            // internal helpers
+            private:
+
+                // grow the file by one window and map it (records never straddle a
+                // window: sizeof(Record) divides both the window and the page size)
+                bool map_window(const std::size_t xi_first) noexcept {
+                    if (m_window != nullptr) {
+                        ::munmap(m_window, WINDOW_BYTES);
+                        m_window = nullptr;
+                    }
+                    if (::ftruncate(m_fd, static_cast<off_t>(xi_first + WINDOW_BYTES)) != 0) {
+                        return false;
+                    }
+
+                    void* base{ ::mmap(nullptr, WINDOW_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, static_cast<off_t>(xi_first)) };
+                    if (base == MAP_FAILED) {
+                        return false;
+                    }
+
+                    m_window       = static_cast<std::byte*>(base);
+                    m_window_first = xi_first;
+                    return true;
+                }
+
+                // pop the next drained record (drain thread only)
+                bool pop(Record& xo_record) noexcept {
+                    Slot& slot{ m_ring[m_head & RING_MASK] };
+                    if (slot._sequence.load(std::memory_order_acquire) != (m_head + 1)) {
+                        return false;
+                    }
+
+                    xo_record = slot._record;
+                    slot._sequence.store(m_head + RING_SIZE, std::memory_order_release);
+                    ++m_head;
+                    return true;
+                }
+
+                // the background thread: ring -> mapped file (a memcpy into the page
+                // cache; the OS writes the pages back on its own schedule)
+                void drain() noexcept {
+                    bool stopping{ false };
+                    while (!stopping) {
+                        stopping = m_stop.load(std::memory_order_acquire);
+
+                        Record record;
+                        bool drained{ false };
+                        while (pop(record)) {
+                            if ((m_file_bytes + sizeof(Record)) > (m_window_first + WINDOW_BYTES)) {
+                                if (!map_window(m_window_first + WINDOW_BYTES)) {
+                                    return;     // disk full / mapping failed; further records stay in the drop count
+                                }
+                            }
+                            std::memcpy(m_window + (m_file_bytes - m_window_first), &record, sizeof(Record));
+                            m_file_bytes += sizeof(Record);
+                            drained = true;
+                        }
+
+                        if (!drained && !stopping) {
+                            std::this_thread::sleep_for(std::chrono::microseconds(200));
+                        }
+                    }
+                }
+        };
+
+        /**
+        * \brief accumulated offline statistics of one callsite (see summarize())
+        **/
+        struct Statistics {
+            // properties
+            std::uint64_t _count{};                                                     // amount of records
+            double _sum{};                                                              // sum of |error|
+            double _max{};                                                              // largest |error|
+            std::uint64_t _first{ std::numeric_limits<std::uint64_t>::max() };          // earliest timestamp [ns]
+            std::uint64_t _last{};                                                      // latest timestamp [ns]
+
+            // fold one record in
+            void add(const Record& xi_record) noexcept {
+                const double magnitude{ std::fabs(xi_record._error) };
+                ++_count;
+                _sum += magnitude;
+                if (magnitude > _max) {
+                    _max = magnitude;
+                }
+                if (xi_record._nanoseconds < _first) {
+                    _first = xi_record._nanoseconds;
+                }
+                if (xi_record._nanoseconds > _last) {
+                    _last = xi_record._nanoseconds;
+                }
+            }
+
+            // mean |error|
+            double mean() const noexcept { return ((_count > 0) ? (_sum / static_cast<double>(_count)) : 0.0); }
+        };
+
+        /**
+        * \brief scan a ledger through a read-only mapping, handing every record to
+        *        a visitor in file (i.e. persistence) order
+        *
+        * @param {char*,    in}  ledger path
+        * @param {callable, in}  visitor; invoked as visitor(const Record&)
+        * @param {bool,     out} true if the file was a valid ledger (possibly empty)
+        **/
+        template<typename VISITOR> bool scan(const char* const xi_path, VISITOR&& xi_visitor) {
+            const int fd{ ::open(xi_path, O_RDONLY) };
+            if (fd < 0) {
+                return false;
+            }
+
+            struct stat status;
+            if ((::fstat(fd, &status) != 0) || (static_cast<std::size_t>(status.st_size) < sizeof(Header)) || ((static_cast<std::size_t>(status.st_size) % sizeof(Record)) != 0)) {
+                ::close(fd);
+                return false;
+            }
+            const std::size_t bytes{ static_cast<std::size_t>(status.st_size) };
+
+            void* base{ ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0) };
+            ::close(fd);    // the mapping keeps its own reference
+            if (base == MAP_FAILED) {
+                return false;
+            }
+
+            Header header;
+            std::memcpy(&header, base, sizeof(Header));
+            const bool sane{ (header._magic == MAGIC) && (header._version == VERSION) && (header._record_bytes == sizeof(Record)) };
+            if (sane) {
+                const Record* record{ reinterpret_cast<const Record*>(static_cast<const std::byte*>(base) + sizeof(Header)) };
+                const std::size_t count{ (bytes - sizeof(Header)) / sizeof(Record) };
+                for (std::size_t i{}; i < count; ++i) {
+                    xi_visitor(record[i]);
+                }
+            }
+
+            ::munmap(base, bytes);
+            return sane;
+        }
+
+        /**
+        * \brief aggregate a ledger into per-callsite statistics
+        *
+        * @param {char*, in}  ledger path
+        * @param {map,   out} callsite id -> its accumulated statistics (empty on an
+        *                     invalid ledger)
+        **/
+        inline std::unordered_map<std::uint32_t, Statistics> summarize(const char* const xi_path) {
+            std::unordered_map<std::uint32_t, Statistics> sites;
+            if (!scan(xi_path, [&sites](const Record& xi_record) { sites[xi_record._site].add(xi_record); })) {
+                sites.clear();
+            }
+            return sites;
+        }
+    }
+#endif
+};
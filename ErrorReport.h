@@ -0,0 +1,195 @@
+#pragma once
+#include<atomic>
+#include<cmath>
+#include<cstdint>
+#include<cstring>
+#include<iostream>
+#include<source_location>
+#include<string>
+#include<unordered_map>
+
+/**
+* ErrorReport is an opt-in instrumentation registry which turns "where did precision die"
+* from a manual bisection into a one-run profile.
+*
+* Define FP_REAL_INSTRUMENT before including Real.h and every mutating operation on a
+* comparison mode Real feeds its running error into a thread local histogram, attributed
+* to the innermost active ErrorReport::Scope (keyed by std::source_location). The hot path
+* is one pointer test plus a handful of adds; thread local aggregates are merged into a
+* global lock-free list when the thread exits, and ErrorReport::dump() prints the merged
+* per-callsite profile.
+*
+* Usage:
+*   #define FP_REAL_INSTRUMENT
+*   #include "Real.h"
+*   ...
+*   { FP::ErrorReport::Scope scope;  // everything below is attributed to this line
+*     ... compare mode arithmetic ... }
+*   FP::ErrorReport::dump();
+*
+* Dan Israel Malta
+**/
+namespace FP {
+    namespace ErrorReport {
+
+        // amount of |error| magnitude bins (bin index is derived from the binary exponent of |error|)
+        constexpr std::size_t BIN_COUNT{ 64 };
+
+        /**
+        * \brief accumulated error statistics of one callsite
+        **/
+        struct Statistics {
+            // properties
+            std::uint64_t _count{};             // amount of recorded operations
+            double _sum{};                      // sum of |error|
+            double _max{};                      // largest |error|
+            std::uint64_t _bins[BIN_COUNT]{};   // histogram over the binary exponent of |error|
+
+            // map |error| to its histogram bin (raw exponent bits, no libm call on the hot path)
+            static std::size_t bin(const double xi_magnitude) noexcept {
+                std::uint64_t bits;
+                std::memcpy(&bits, &xi_magnitude, sizeof(bits));
+                return static_cast<std::size_t>(((bits >> 52) & 0x7FF) >> 5);
+            }
+
+            // record one error observation
+            void add(const double xi_error) noexcept {
+                const double magnitude{ std::fabs(xi_error) };
+                ++_count;
+                _sum += magnitude;
+                if (magnitude > _max) {
+                    _max = magnitude;
+                }
+                ++_bins[bin(magnitude)];
+            }
+
+            // merge another callsite's statistics into this one
+            void merge(const Statistics& xi_other) noexcept {
+                _count += xi_other._count;
+                _sum   += xi_other._sum;
+                if (xi_other._max > _max) {
+                    _max = xi_other._max;
+                }
+                for (std::size_t i{}; i < BIN_COUNT; ++i) {
+                    _bins[i] += xi_other._bins[i];
+                }
+            }
+        };
+
+        // internal machinery
+        namespace detail {
+
+            // node of the global (lock-free, push only) list of exited threads' aggregates
+            struct Node {
+                std::string _name;      // callsite ("file:line (function)")
+                Statistics _stats;      // its accumulated statistics
+                Node* _next;
+            };
+
+            inline std::atomic<Node*>& head() noexcept {
+                static std::atomic<Node*> s_head{ nullptr };
+                return s_head;
+            }
+
+            inline void publish(std::string&& xi_name, const Statistics& xi_stats) {
+                Node* node{ new Node{ std::move(xi_name), xi_stats, nullptr } };
+                Node* old{ head().load(std::memory_order_relaxed) };
+                do {
+                    node->_next = old;
+                } while (!head().compare_exchange_weak(old, node, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            // bucket the current thread's operations record into (null when no Scope is active)
+            inline thread_local Statistics* t_current{ nullptr };
+
+            // per-thread registry; merged into the global list on thread exit
+            struct ThreadRegistry {
+                std::unordered_map<std::string, Statistics> _sites;
+
+                ~ThreadRegistry() {
+                    for (auto& site : _sites) {
+                        publish(std::string(site.first), site.second);
+                    }
+                }
+            };
+
+            inline ThreadRegistry& registry() {
+                thread_local ThreadRegistry s_registry;
+                return s_registry;
+            }
+        }
+
+        /**
+        * \brief record one compare-mode error observation into the innermost active
+        *        Scope's bucket (no-op when no Scope is active; this is the hot path)
+        *
+        * @param {double, in} error (exact - value) of the operation just performed
+        **/
+        inline void record(const double xi_error) noexcept {
+            if (detail::t_current != nullptr) {
+                detail::t_current->add(xi_error);
+            }
+        }
+
+        /**
+        * \brief RAII scope; while alive, compare-mode operations on this thread are
+        *        attributed to the callsite at which the scope was constructed
+        **/
+        class Scope {
+            // properties
+            private:
+                Statistics* m_previous;     // bucket of the enclosing scope (restored at destruction)
+
+            public:
+                explicit Scope(const std::source_location xi_location = std::source_location::current()) : m_previous(detail::t_current) {
+                    std::string key{ xi_location.file_name() };
+                    key += ':';
+                    key += std::to_string(xi_location.line());
+                    key += " (";
+                    key += xi_location.function_name();
+                    key += ')';
+                    detail::t_current = &detail::registry()._sites[std::move(key)];
+                }
+
+                ~Scope() { detail::t_current = m_previous; }
+
+                Scope(const Scope&)            = delete;
+                Scope& operator=(const Scope&) = delete;
+        };
+
+        /**
+        * \brief print the merged per-callsite error profile (exited threads' published
+        *        aggregates plus the calling thread's live ones), worst offender first
+        *
+        * @param {ostream, in/out} stream to print into (std::cout by default)
+        **/
+        inline void dump(std::ostream& xio_stream = std::cout) {
+            std::unordered_map<std::string, Statistics> merged;
+
+            for (detail::Node* node{ detail::head().load(std::memory_order_acquire) }; node != nullptr; node = node->_next) {
+                merged[node->_name].merge(node->_stats);
+            }
+            for (const auto& site : detail::registry()._sites) {
+                merged[site.first].merge(site.second);
+            }
+
+            // print, worst maximal error first
+            while (!merged.empty()) {
+                auto worst{ merged.begin() };
+                for (auto it{ merged.begin() }; it != merged.end(); ++it) {
+                    if (it->second._max > worst->second._max) {
+                        worst = it;
+                    }
+                }
+
+                const Statistics& stats{ worst->second };
+                const double mean{ (stats._count > 0) ? (stats._sum / static_cast<double>(stats._count)) : 0.0 };
+                xio_stream << worst->first
+                           << ": count = " << stats._count
+                           << ", mean |error| = " << mean
+                           << ", max |error| = " << stats._max << "\n";
+                merged.erase(worst);
+            }
+        }
+    }
+}
@@ -0,0 +1,228 @@
+#pragma once
+#include"Real/core.h"
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<thread>
+#include<vector>
+
+/**
+* ErrorScan is the read side of compare mode telemetry: after a run it answers
+* "how bad did the error get, and where" over huge buffers of comparison mode Real's.
+*
+* scan_errors(first, last) returns the largest |error| together with its index, plus
+* the mean |error| and the RMS error of the whole range. The scan is striped over
+* several independent partial reductions (so the inner loop vectorizes) and, for
+* large ranges, split across hardware threads. The threshold overload scans in
+* chunks and returns as soon as a chunk contains an |error| above the threshold,
+* so a "did anything go wrong" query over a healthy buffer stays cheap.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief result of one error scan
+    **/
+    struct ErrorScanResult {
+        double _max{};              // largest |error| in the scanned range
+        std::size_t _max_index{};   // index (relative to 'first') of the largest |error|
+        double _mean{};             // mean of |error| over the scanned range
+        double _rms{};              // root mean square of the error over the scanned range
+        std::uint64_t _count{};     // amount of scanned elements (smaller than the range on early exit)
+        bool _exceeded{ false };    // threshold overloads only: was the threshold exceeded?
+    };
+
+    // internal machinery
+    namespace detail {
+
+        // partial reduction of one contiguous chunk of errors
+        struct errorChunk {
+            double _max{};
+            std::size_t _max_index{};
+            double _sum{};
+            double _sum_squared{};
+
+            // scan [xi_first, xi_first + xi_size) of errors produced by 'xi_error(i)',
+            // striped over several independent partials so the loop vectorizes
+            template<typename ERROR_AT> void scan(const std::size_t xi_first, const std::size_t xi_size, ERROR_AT&& xi_error) noexcept {
+                constexpr std::size_t STRIPES{ 8 };
+                double maxs[STRIPES]{};
+                std::size_t arg_maxs[STRIPES]{};
+                double sums[STRIPES]{};
+                double sums_squared[STRIPES]{};
+
+                std::size_t i{};
+                for (; (i + STRIPES) <= xi_size; i += STRIPES) {
+                    for (std::size_t s{}; s < STRIPES; ++s) {
+                        const double error{ static_cast<double>(xi_error(xi_first + i + s)) };
+                        const double magnitude{ (error < 0.0) ? -error : error };
+                        sums[s]         += magnitude;
+                        sums_squared[s] += error * error;
+                        if (magnitude > maxs[s]) {
+                            maxs[s]     = magnitude;
+                            arg_maxs[s] = xi_first + i + s;
+                        }
+                    }
+                }
+                for (; i < xi_size; ++i) {
+                    const double error{ static_cast<double>(xi_error(xi_first + i)) };
+                    const double magnitude{ (error < 0.0) ? -error : error };
+                    sums[0]         += magnitude;
+                    sums_squared[0] += error * error;
+                    if (magnitude > maxs[0]) {
+                        maxs[0]     = magnitude;
+                        arg_maxs[0] = xi_first + i;
+                    }
+                }
+
+                for (std::size_t s{}; s < STRIPES; ++s) {
+                    _sum         += sums[s];
+                    _sum_squared += sums_squared[s];
+                    if (maxs[s] > _max) {
+                        _max       = maxs[s];
+                        _max_index = arg_maxs[s];
+                    }
+                }
+            }
+
+            // merge another chunk's partials into this one
+            void merge(const errorChunk& xi_other) noexcept {
+                _sum         += xi_other._sum;
+                _sum_squared += xi_other._sum_squared;
+                if (xi_other._max > _max) {
+                    _max       = xi_other._max;
+                    _max_index = xi_other._max_index;
+                }
+            }
+        };
+
+        // finalize partials of 'xi_count' scanned elements into a result
+        inline ErrorScanResult error_scan_result(const errorChunk& xi_chunk, const std::uint64_t xi_count) noexcept {
+            ErrorScanResult result;
+            result._max       = xi_chunk._max;
+            result._max_index = xi_chunk._max_index;
+            result._count     = xi_count;
+            if (xi_count > 0) {
+                result._mean = xi_chunk._sum / static_cast<double>(xi_count);
+                result._rms  = std::sqrt(xi_chunk._sum_squared / static_cast<double>(xi_count));
+            }
+            return result;
+        }
+
+        // full scan of 'xi_size' errors; ranges this long and up are split across hardware threads
+        template<typename ERROR_AT> ErrorScanResult scan_errors_impl(const std::size_t xi_size, ERROR_AT&& xi_error) {
+            constexpr std::size_t PARALLEL_THRESHOLD{ std::size_t(1) << 20 };
+
+            errorChunk total;
+            const std::size_t workers{ (xi_size >= PARALLEL_THRESHOLD) ? static_cast<std::size_t>(std::thread::hardware_concurrency()) : std::size_t(1) };
+            if (workers > 1) {
+                std::vector<errorChunk> chunks(workers);
+                std::vector<std::thread> threads;
+                threads.reserve(workers - 1);
+
+                const std::size_t share{ xi_size / workers };
+                for (std::size_t w{ 1 }; w < workers; ++w) {
+                    const std::size_t first{ w * share };
+                    const std::size_t size{ (w + 1 < workers) ? share : (xi_size - first) };
+                    threads.emplace_back([&chunks, &xi_error, w, first, size] { chunks[w].scan(first, size, xi_error); });
+                }
+                chunks[0].scan(0, share, xi_error);
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                for (const errorChunk& chunk : chunks) {
+                    total.merge(chunk);
+                }
+            }
+            else {
+                total.scan(0, xi_size, xi_error);
+            }
+
+            return error_scan_result(total, xi_size);
+        }
+
+        // chunked scan which returns as soon as a chunk holds an |error| above the threshold
+        template<typename ERROR_AT> ErrorScanResult scan_errors_threshold_impl(const std::size_t xi_size, const double xi_threshold, ERROR_AT&& xi_error) {
+            constexpr std::size_t CHUNK{ 4096 };
+
+            errorChunk total;
+            std::size_t scanned{};
+            while (scanned < xi_size) {
+                const std::size_t size{ ((xi_size - scanned) < CHUNK) ? (xi_size - scanned) : CHUNK };
+
+                errorChunk chunk;
+                chunk.scan(scanned, size, xi_error);
+                total.merge(chunk);
+                scanned += size;
+
+                if (chunk._max > xi_threshold) {
+                    ErrorScanResult result{ error_scan_result(total, scanned) };
+                    result._exceeded = true;
+                    return result;
+                }
+            }
+
+            return error_scan_result(total, scanned);
+        }
+    }
+
+    /**
+    * \brief scan a contiguous range of comparison mode Real's and return the largest
+    *        |error| (with its index), the mean |error| and the RMS error
+    *
+    * @param {Real*,          in}  first element
+    * @param {Real*,          in}  one past the last element
+    * @param {ErrorScanResult, out} scan result
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    ErrorScanResult scan_errors(const Real<PRECISION, COMPARE>* const xi_first, const Real<PRECISION, COMPARE>* const xi_last) {
+        static_assert(COMPARE == Compare::Yes, "FP::scan_errors: only comparison mode Real's carry an error to scan.");
+        return detail::scan_errors_impl(static_cast<std::size_t>(xi_last - xi_first),
+                                        [xi_first](const std::size_t i) { return xi_first[i].error(); });
+    }
+
+    /**
+    * \brief threshold overload; scans in chunks and returns as soon as a chunk holds
+    *        an |error| above 'xi_threshold' (result then covers the scanned prefix
+    *        only, with _exceeded set and _max_index pointing at the offender)
+    *
+    * @param {Real*,          in}  first element
+    * @param {Real*,          in}  one past the last element
+    * @param {double,         in}  |error| threshold above which the scan stops
+    * @param {ErrorScanResult, out} scan result
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    ErrorScanResult scan_errors(const Real<PRECISION, COMPARE>* const xi_first, const Real<PRECISION, COMPARE>* const xi_last, const double xi_threshold) {
+        static_assert(COMPARE == Compare::Yes, "FP::scan_errors: only comparison mode Real's carry an error to scan.");
+        return detail::scan_errors_threshold_impl(static_cast<std::size_t>(xi_last - xi_first), xi_threshold,
+                                                  [xi_first](const std::size_t i) { return xi_first[i].error(); });
+    }
+
+    /**
+    * \brief plane overloads for structure-of-arrays storage (e.g. - RealArray's
+    *        values() and exacts() planes); error of element i is exacts[i] - values[i]
+    *
+    * @param {span,           in}  'used' values plane
+    * @param {span,           in}  'exact' values plane (same length)
+    * @param {ErrorScanResult, out} scan result
+    **/
+    template<typename TYPE, typename EXACT>
+    ErrorScanResult scan_errors(const std::span<TYPE> xi_values, const std::span<EXACT> xi_exacts) {
+        static_assert(std::is_same<std::remove_const_t<EXACT>, double>::value, "FP::scan_errors: the 'exact' plane holds doubles.");
+        return detail::scan_errors_impl(xi_values.size(),
+                                        [values = xi_values.data(), exacts = xi_exacts.data()](const std::size_t i) {
+                                            return (exacts[i] - static_cast<double>(values[i]));
+                                        });
+    }
+
+    template<typename TYPE, typename EXACT>
+    ErrorScanResult scan_errors(const std::span<TYPE> xi_values, const std::span<EXACT> xi_exacts, const double xi_threshold) {
+        static_assert(std::is_same<std::remove_const_t<EXACT>, double>::value, "FP::scan_errors: the 'exact' plane holds doubles.");
+        return detail::scan_errors_threshold_impl(xi_values.size(), xi_threshold,
+                                                  [values = xi_values.data(), exacts = xi_exacts.data()](const std::size_t i) {
+                                                      return (exacts[i] - static_cast<double>(values[i]));
+                                                  });
+    }
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include"Real/core.h"
+#include<bit>
+#include<cmath>
+#include<cstdint>
+
+/**
+* FastMath is the FP::fast namespace: approximate kernels for callsites where a
+* few good digits beat a full libm call - rsqrt, rcp (bit trick seed + Newton
+* refinement, ~6-7 correct bits per refinement step) and exp, log (Schraudolph
+* exponent-field construction, ~2% worst case). The approximation runs on the
+* 'used' lane only; in shadow carrying modes (Compare::Yes / Compare::Trap) the
+* 'exact' lane keeps full precision libm, so error() quantifies exactly what the
+* approximation costs on live data - accuracy/speed can be tuned per callsite
+* with measurements instead of guesses.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+    namespace fast {
+
+        // internal: the approximate lane kernels (16bit lanes run the float kernel
+        // via detail::math_arg widening, like the libm wrappers in Real/math.h)
+        namespace detail {
+
+            // reciprocal square root: exponent-halving bit trick seed, two Newton steps
+            inline float rsqrt_lane(const float x) noexcept {
+                float y{ std::bit_cast<float>(UINT32_C(0x5f3759df) - (std::bit_cast<std::uint32_t>(x) >> 1)) };
+                y = y * (1.5f - 0.5f * x * y * y);
+                y = y * (1.5f - 0.5f * x * y * y);
+                return y;
+            }
+            inline double rsqrt_lane(const double x) noexcept {
+                double y{ std::bit_cast<double>(UINT64_C(0x5fe6eb50c7b537a9) - (std::bit_cast<std::uint64_t>(x) >> 1)) };
+                y = y * (1.5 - 0.5 * x * y * y);
+                y = y * (1.5 - 0.5 * x * y * y);
+                return y;
+            }
+
+            // reciprocal: exponent-negating bit trick seed, two Newton steps
+            inline float rcp_lane(const float x) noexcept {
+                float y{ std::bit_cast<float>(UINT32_C(0x7ef311c3) - std::bit_cast<std::uint32_t>(x)) };
+                y = y * (2.0f - x * y);
+                y = y * (2.0f - x * y);
+                return y;
+            }
+            inline double rcp_lane(const double x) noexcept {
+                double y{ std::bit_cast<double>(UINT64_C(0x7fde623822ffbed0) - std::bit_cast<std::uint64_t>(x)) };
+                y = y * (2.0 - x * y);
+                y = y * (2.0 - x * y);
+                return y;
+            }
+
+            // exponential: write x/ln(2) straight into the exponent field
+            // (Schraudolph's construction; ~2% worst case relative error)
+            inline float exp_lane(const float x) noexcept {
+                const std::int32_t bits{ static_cast<std::int32_t>(12102203.161561485f * x + 1064986823.0f) };
+                return std::bit_cast<float>(bits);
+            }
+            inline double exp_lane(const double x) noexcept {
+                const std::int32_t high{ static_cast<std::int32_t>(1512775.3951951856 * x + 1072632447.0) };
+                return std::bit_cast<double>(static_cast<std::uint64_t>(static_cast<std::uint32_t>(high)) << 32);
+            }
+
+            // natural logarithm: the exponential construction, inverted
+            inline float log_lane(const float x) noexcept {
+                return (static_cast<float>(std::bit_cast<std::int32_t>(x)) - 1064986823.0f) * (1.0f / 12102203.161561485f);
+            }
+            inline double log_lane(const double x) noexcept {
+                return (static_cast<double>(static_cast<std::int32_t>(std::bit_cast<std::uint64_t>(x) >> 32)) - 1072632447.0) * (1.0 / 1512775.3951951856);
+            }
+        }
+
+        // --- the approximate functions (value lane approximate, shadow lane exact) ---
+#define M_FAST_FUNCTION(NAME, EXACT_OPERATION)                                                                        \
+        template<Precision P, Compare C> inline Real<P, C> NAME(const Real<P, C>& r) noexcept {                       \
+            using TYPE = typename Real<P, C>::TYPE;                                                                   \
+            const TYPE approximation{ static_cast<TYPE>(fast::detail::NAME##_lane(FP::detail::math_arg(r.value()))) };\
+            if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                              \
+                return Real<P, C>(approximation, EXACT_OPERATION(r.exact()));                                         \
+            }                                                                                                         \
+            else {                                                                                                    \
+                return Real<P, C>(approximation);                                                                     \
+            }                                                                                                         \
+        }                                                                                                             \
+        template<typename E, typename = std::enable_if_t<FP::detail::is_expression<E>::value>>                        \
+        inline auto NAME(const E& xi_expression) noexcept {                                                           \
+            return NAME(FP::detail::real_of_t<E>(xi_expression));                                                     \
+        }
+
+        M_FAST_FUNCTION(rsqrt, [](const double e) { return (1.0 / std::sqrt(e)); });
+        M_FAST_FUNCTION(rcp,   [](const double e) { return (1.0 / e);            });
+        M_FAST_FUNCTION(exp,   std::exp);
+        M_FAST_FUNCTION(log,   std::log);
+
+#undef M_FAST_FUNCTION
+    }
+};
@@ -0,0 +1,44 @@
+// FP.Real - importable module unit of Real (C++20 modules).
+//
+// An alternative to including Real.h: build this file as a module interface unit
+// (e.g. - "g++ -std=c++20 -fmodules-ts -x c++ Real/FP.Real.cppm -c") and translation
+// units can then "import FP.Real;" instead of re-parsing the headers. The headers
+// stay the single source of truth: the standard library is attached to the global
+// module fragment, and the Real headers are included inside an exported linkage
+// block so their entire public surface (namespace FP and the std::formatter
+// specialization) is re-exported as-is.
+//
+// Dan Israel Malta
+module;
+#include<charconv>
+#include<cmath>
+#include<cstdint>
+#include<limits>
+#include<type_traits>
+#include<iostream>
+#include<bit>
+#include<cstddef>
+#include<functional>
+#include<span>
+#include<utility>
+#include<vector>
+#if defined(__cpp_lib_format)
+#include<format>
+#include<string_view>
+#endif
+#if defined(FP_REAL_INSTRUMENT)
+#include<atomic>
+#include<cstring>
+#include<source_location>
+#include<string>
+#include<unordered_map>
+#endif
+
+export module FP.Real;
+
+export extern "C++" {
+#include"core.h"
+#include"math.h"
+#include"io.h"
+#include"traits.h"
+}
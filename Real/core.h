@@ -0,0 +1,1316 @@
+#pragma once
+#include<bit>
+#include<charconv>
+#include<cmath>
+#include<cstdint>
+#include<limits>
+#include<type_traits>
+#include"deferred.h"
+
+
+// 16bit floating point support (Precision::Half / Precision::BFloat16):
+// pick the native backing type when the toolchain provides one
+#if defined(__STDCPP_FLOAT16_T__) || defined(__STDCPP_BFLOAT16_T__)
+#include<stdfloat>
+#endif
+#if defined(__STDCPP_FLOAT16_T__)
+#define FP_REAL_HALF_TYPE std::float16_t
+#elif defined(__FLT16_MAX__)
+#define FP_REAL_HALF_TYPE _Float16
+#endif
+#if defined(__STDCPP_BFLOAT16_T__)
+#define FP_REAL_BFLOAT16_TYPE std::bfloat16_t
+#endif
+
+// device offload: under CUDA/HIP every operator, accessor and math wrapper carries
+// host+device annotations, so Real in its stateless tracking modes (No, Yes,
+// Bound, Interval) works inside kernels and results read back through the usual
+// error()/bound() API; the stateful modes (Deferred, Stochastic, Trap) and the
+// textual machinery (to_chars, streaming) stay host side. off CUDA/HIP the
+// annotation compiles away
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define FP_REAL_DEVICE __host__ __device__
+#else
+#define FP_REAL_DEVICE
+#endif
+
+// opt-in instrumentation: define FP_REAL_INSTRUMENT to feed the running error of every
+// mutating compare-mode operation into the ErrorReport registry (see ErrorReport.h)
+#if defined(FP_REAL_INSTRUMENT)
+#include"../ErrorReport.h"
+#define M_REAL_RECORD(VALUE, EXACT) FP::ErrorReport::record(static_cast<double>(EXACT) - static_cast<double>(VALUE))
+#else
+#define M_REAL_RECORD(VALUE, EXACT) ((void)0)
+#endif
+
+/**
+* Real/core.h - the Real type itself, its expression templates and its operators
+* (arithmetic, assignment, relational). Include this directly when a translation
+* unit only computes: it pulls in no iostream machinery and none of the libm
+* wrapper instantiation sites (those live in Real/math.h; streaming and
+* std::format support live in Real/io.h; Real.h remains the all-in-one header).
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+
+    // floating point variable precision to be used in calculations
+    enum class Precision : std::uint8_t {
+        Single,         // single precision (32bit)
+        Double,         // double precision (64bit)
+        Half,           // half precision (16bit; requires native _Float16/std::float16_t support)
+        BFloat16        // brain floating point (16bit; requires native std::bfloat16_t support)
+    };
+
+    // how should the accuracy of a variable be tracked?
+    enum class Compare : std::uint8_t {
+        No,         // no tracking (variable behaves as a plain float/double)
+        Yes,        // carry an 'exact' double shadow and compare against it
+        Bound,      // carry a running upper bound on |exact - value|, propagated with
+                    // first order ULP rules per operation (cheap enough for release builds;
+                    // note: the bound is only propagated through +,-,*,/ and fma - the
+                    // unary/binary math functions restart it at zero)
+        Deferred,   // record each operation onto the calling thread's tape (one compact
+                    // store per op; see Real/deferred.h) and reconstruct 'exact'/error
+                    // later via FP::replay(), off the hot path; note: like Bound mode,
+                    // only +,-,*,/ and fma are tracked - the unary/binary math functions
+                    // restart the shadow at their computed value
+        Trap,       // carry the 'exact' shadow like Yes and, after every mutating
+                    // operation, compare |exact - value| against the precision's
+                    // registered threshold, invoking the registered handler on
+                    // violation (one well predicted compare; see FP::Trap below)
+        Interval,   // carry a guaranteed enclosure [lo, hi] of the exact value,
+                    // widened one representable step outward per operation (directed
+                    // rounding via a bit nudge on the endpoints - no pipeline draining
+                    // fesetround calls); like Bound mode, only +,-,*,/ and fma
+                    // propagate - the math functions restart the enclosure at their result
+        Stochastic  // perturb every operation's rounding by one ULP in a random
+                    // direction (CESTAC style; one xorshift draw plus one integer
+                    // nudge per op, no extra storage). running the binary a few times
+                    // and comparing results estimates the accumulated rounding error -
+                    // including for Precision::Double, where no wider shadow exists;
+                    // seed per run via FP::Stochastic::seed() for reproducibility
+    };
+
+    // Compare::Trap machinery: a per-precision |error| threshold checked after every
+    // mutating operation, and a handler invoked on violation. the handler receives the
+    // operation's value, exact value and error; capturing the violating source location
+    // is up to the handler (e.g. - via a backtrace), since an operator overload can not
+    // default-capture its caller's std::source_location
+    namespace Trap {
+
+        // handler invoked when a mutating operation's |error| exceeds the threshold
+        using Handler = void (*)(const double xi_value, const double xi_exact, const double xi_error);
+
+        // internal: per-precision threshold & handler
+        namespace detail {
+            template<Precision P> struct registry {
+                static inline Handler _handler{ nullptr };
+                static inline double _threshold{ std::numeric_limits<double>::infinity() };
+            };
+        }
+
+        /**
+        * \brief register the |error| threshold and violation handler of one precision
+        *
+        * @param {double,  in} |exact - value| above which the handler fires
+        * @param {Handler, in} handler to invoke (nullptr silences trapping)
+        **/
+        template<Precision P> inline void on_violation(const double xi_threshold, const Handler xi_handler) noexcept {
+            Trap::detail::registry<P>::_threshold = xi_threshold;
+            Trap::detail::registry<P>::_handler   = xi_handler;
+        }
+
+        // hot path check: one compare against the threshold (never taken while healthy)
+        template<Precision P> inline void check(const double xi_value, const double xi_exact) {
+            const double error{ xi_exact - xi_value };
+            const double magnitude{ (error < 0.0) ? -error : error };
+            if (magnitude > Trap::detail::registry<P>::_threshold) [[unlikely]] {
+                if (const Handler handler{ Trap::detail::registry<P>::_handler }; handler != nullptr) {
+                    handler(xi_value, xi_exact, error);
+                }
+            }
+        }
+    }
+
+    // Compare::Stochastic machinery: the per-thread xorshift state behind the random
+    // rounding perturbation. left unseeded, the first draw seeds itself from the
+    // state's own address, so separate runs (under address space randomization) and
+    // separate threads perturb differently - which is exactly what comparing a few
+    // runs of the binary needs; call seed() for a reproducible sequence
+    namespace Stochastic {
+
+        // internal: per-thread generator state (0 means 'not yet seeded')
+        namespace detail {
+            inline thread_local std::uint64_t t_state{ 0 };
+        }
+
+        // seed the calling thread's perturbation sequence
+        inline void seed(const std::uint64_t xi_seed) noexcept {
+            Stochastic::detail::t_state = (xi_seed != 0) ? xi_seed : 1;
+        }
+
+        // next draw of the calling thread's generator (xorshift64)
+        inline std::uint64_t next() noexcept {
+            std::uint64_t x{ Stochastic::detail::t_state };
+            if (x == 0) {
+                x = (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&Stochastic::detail::t_state)) * 0x9e3779b97f4a7c15ull) | 1;
+            }
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            Stochastic::detail::t_state = x;
+            return x;
+        }
+    }
+
+    // forward declarations
+    template<Precision, Compare> class Real;
+    template<Precision, Compare, typename, typename, typename> struct RealExpression;
+    template<Precision, Compare, typename, typename, typename> struct RealFmaExpression;
+
+    // internal helpers for expression templates
+    namespace detail {
+
+        // backing type of each Precision (a precision with no native backing
+        // type on the current toolchain fails with a message at instantiation)
+        template<Precision P> struct precision_type {
+            static_assert(static_cast<int>(P) < 0, "Real: this toolchain has no native backing type for the requested Precision.");
+        };
+        template<> struct precision_type<Precision::Single> { using type = float;  };
+        template<> struct precision_type<Precision::Double> { using type = double; };
+#if defined(FP_REAL_HALF_TYPE)
+        template<> struct precision_type<Precision::Half> { using type = FP_REAL_HALF_TYPE; };
+#endif
+#if defined(FP_REAL_BFLOAT16_TYPE)
+        template<> struct precision_type<Precision::BFloat16> { using type = FP_REAL_BFLOAT16_TYPE; };
+#endif
+        template<Precision P> using precision_type_t = typename precision_type<P>::type;
+
+        // the wider of two precisions (mixed precision expressions evaluate in it;
+        // equally wide but different 16bit precisions widen to Single, since
+        // neither can represent the other's values)
+        template<Precision A, Precision B> FP_REAL_DEVICE constexpr Precision wider_precision() {
+            if constexpr (A == B) {
+                return A;
+            }
+            else if constexpr (sizeof(precision_type_t<A>) > sizeof(precision_type_t<B>)) {
+                return A;
+            }
+            else if constexpr (sizeof(precision_type_t<B>) > sizeof(precision_type_t<A>)) {
+                return B;
+            }
+            else {
+                return Precision::Single;
+            }
+        }
+
+        // classification of an expression operand (general case: neither Real nor expression)
+        template<typename T> struct operand_traits {
+            static constexpr bool is_real{ false };
+            static constexpr bool is_scalar{ std::is_arithmetic<T>::value };
+        };
+
+        template<Precision P, Compare C> struct operand_traits<Real<P, C>> {
+            static constexpr bool is_real{ true };
+            static constexpr bool is_scalar{ false };
+            static constexpr Precision precision{ P };
+            static constexpr Compare compare{ C };
+        };
+
+        template<Precision P, Compare C, typename OP, typename LHS, typename RHS> struct operand_traits<RealExpression<P, C, OP, LHS, RHS>> {
+            static constexpr bool is_real{ true };
+            static constexpr bool is_scalar{ false };
+            static constexpr Precision precision{ P };
+            static constexpr Compare compare{ C };
+        };
+
+        template<Precision P, Compare C, typename A, typename B, typename ADDEND> struct operand_traits<RealFmaExpression<P, C, A, B, ADDEND>> {
+            static constexpr bool is_real{ true };
+            static constexpr bool is_scalar{ false };
+            static constexpr Precision precision{ P };
+            static constexpr Compare compare{ C };
+        };
+
+        // is T an expression node?
+        template<typename T>                                                       struct is_expression                                  : std::false_type {};
+        template<Precision P, Compare C, typename OP, typename LHS, typename RHS> struct is_expression<RealExpression<P, C, OP, LHS, RHS>> : std::true_type  {};
+        template<Precision P, Compare C, typename A, typename B, typename ADDEND> struct is_expression<RealFmaExpression<P, C, A, B, ADDEND>> : std::true_type {};
+
+        // is T an expression node evaluating to Real<P, C>?
+        template<typename T, Precision P, Compare C> FP_REAL_DEVICE constexpr bool is_expression_of_check() {
+            if constexpr (is_expression<T>::value) {
+                return ((operand_traits<T>::precision == P) && (operand_traits<T>::compare == C));
+            }
+            else {
+                return false;
+            }
+        }
+        template<typename T, Precision P, Compare C> struct is_expression_of {
+            static constexpr bool value{ is_expression_of_check<T, P, C>() };
+        };
+
+        // can LHS and RHS be combined into one expression?
+        template<typename LHS, typename RHS> FP_REAL_DEVICE constexpr bool expression_valid() {
+            using lt = operand_traits<std::decay_t<LHS>>;
+            using rt = operand_traits<std::decay_t<RHS>>;
+
+            if constexpr (lt::is_real && rt::is_real) {
+                return (lt::compare == rt::compare);
+            }
+            else {
+                return ((lt::is_real && rt::is_scalar) || (lt::is_scalar && rt::is_real));
+            }
+        }
+
+        // precision/compare of the Real an expression over LHS & RHS evaluates to
+        template<typename LHS, typename RHS> FP_REAL_DEVICE constexpr Precision pick_precision() {
+            using lt = operand_traits<std::decay_t<LHS>>;
+            using rt = operand_traits<std::decay_t<RHS>>;
+
+            if constexpr (lt::is_real && rt::is_real) {
+                return wider_precision<lt::precision, rt::precision>();
+            }
+            else if constexpr (lt::is_real) {
+                return lt::precision;
+            }
+            else {
+                return rt::precision;
+            }
+        }
+        template<typename LHS, typename RHS> FP_REAL_DEVICE constexpr Compare pick_compare() {
+            if constexpr (operand_traits<std::decay_t<LHS>>::is_real) {
+                return operand_traits<std::decay_t<LHS>>::compare;
+            }
+            else {
+                return operand_traits<std::decay_t<RHS>>::compare;
+            }
+        }
+
+        // libm has no 16bit overloads; sub-float lane values are widened to float
+        // for math calls (results narrow back to the lane type on construction)
+        template<typename T> FP_REAL_DEVICE constexpr auto math_arg(const T xi_value) noexcept {
+            if constexpr (sizeof(T) < sizeof(float)) {
+                return static_cast<float>(xi_value);
+            }
+            else {
+                return xi_value;
+            }
+        }
+
+        // extract an operand's 'used' lane (scalars are cast to the lane type)
+        template<typename TYPE, typename T> FP_REAL_DEVICE constexpr TYPE value_of(const T& xi_operand) noexcept {
+            if constexpr (std::is_arithmetic<T>::value) {
+                return static_cast<TYPE>(xi_operand);
+            }
+            else {
+                return xi_operand.value();
+            }
+        }
+
+        // extract an operand's 'exact' lane (scalars are cast to double)
+        template<typename T> FP_REAL_DEVICE constexpr double exact_of(const T& xi_operand) noexcept {
+            if constexpr (std::is_arithmetic<T>::value) {
+                return static_cast<double>(xi_operand);
+            }
+            else {
+                return xi_operand.exact();
+            }
+        }
+
+        // record id of an operand on the calling thread's tape (deferred mode;
+        // scalars become literal records, expressions record their whole tree)
+        template<typename T> std::uint32_t id_of(const T& xi_operand) {
+            if constexpr (std::is_arithmetic<T>::value) {
+                return Deferred::tape().literal(static_cast<double>(xi_operand));
+            }
+            else if constexpr (is_expression<std::decay_t<T>>::value) {
+                return xi_operand.record();
+            }
+            else {
+                return xi_operand.id();
+            }
+        }
+
+        // the Real an expression (or Real) operand evaluates to
+        template<typename E> using real_of_t = Real<operand_traits<std::decay_t<E>>::precision, operand_traits<std::decay_t<E>>::compare>;
+
+        // collapse an operand for a function call taking Real's/scalars (expressions are evaluated)
+        template<typename REAL, typename T> FP_REAL_DEVICE constexpr auto as_operand(const T& xi_operand) noexcept {
+            if constexpr (std::is_arithmetic<T>::value) {
+                return static_cast<typename REAL::TYPE>(xi_operand);
+            }
+            else {
+                return REAL(xi_operand);
+            }
+        }
+
+        // |x|, usable in constexpr bound propagation
+        template<typename T> FP_REAL_DEVICE constexpr T bound_abs(const T xi_value) noexcept { return ((xi_value < T(0)) ? -xi_value : xi_value); }
+
+        // unit roundoff (half ULP) of a lane type
+        template<typename T> FP_REAL_DEVICE constexpr T half_ulp() noexcept { return (std::numeric_limits<T>::epsilon() / T(2)); }
+
+        // smallest unsigned integer holding exactly the bits of one lane value
+        template<typename TYPE> using lane_bits_t = typename std::conditional<sizeof(TYPE) == 8, std::uint64_t,
+                                                    typename std::conditional<sizeof(TYPE) == 4, std::uint32_t, std::uint16_t>::type>::type;
+
+        // one lane's enclosure of the exact value (Compare::Interval)
+        template<typename T> struct lane_interval {
+            T _lo;      // lower endpoint (exact value is >= it)
+            T _hi;      // upper endpoint (exact value is <= it)
+        };
+
+        // next representable value above/below x. IEEE values of one sign order like
+        // their bit patterns, so one integer nudge gives directed rounding without
+        // std::fesetround (which drains the pipeline) or std::nextafter (which has
+        // no 16bit lane overloads); infinities and NaN stay put
+        template<typename T> FP_REAL_DEVICE constexpr T next_up(const T xi_value) noexcept {
+            using BITS = lane_bits_t<T>;
+            if (!(xi_value < std::numeric_limits<T>::infinity())) {
+                return xi_value;
+            }
+            if (xi_value == T(0)) {
+                return std::bit_cast<T>(BITS(1));
+            }
+            const BITS bits{ std::bit_cast<BITS>(xi_value) };
+            return std::bit_cast<T>(static_cast<BITS>((xi_value > T(0)) ? (bits + 1) : (bits - 1)));
+        }
+        template<typename T> FP_REAL_DEVICE constexpr T next_down(const T xi_value) noexcept { return -next_up(static_cast<T>(-xi_value)); }
+
+        // nudge a freshly rounded result one representable step in a random direction
+        // (Compare::Stochastic; one xorshift draw plus one integer nudge per operation)
+        template<typename T> FP_REAL_DEVICE inline T perturb(const T xi_value) noexcept {
+            return ((Stochastic::next() & 1) != 0) ? next_up(xi_value) : next_down(xi_value);
+        }
+
+        // operation tags (applied per lane at evaluation; 'bound' implements the first
+        // order ULP propagation rule of each operation, for Compare::Bound tracking)
+        struct add_op {
+            static constexpr Deferred::Op tape_op{ Deferred::Op::Add };
+            static constexpr Deferred::Op tape_op_literal{ Deferred::Op::AddLiteral };
+            template<typename T> static FP_REAL_DEVICE constexpr T apply(const T l, const T r) noexcept { return (l + r); }
+            template<typename T> static FP_REAL_DEVICE constexpr T bound(const T, const T, const T bl, const T br, const T result) noexcept {
+                return (bl + br + half_ulp<T>() * bound_abs(result));
+            }
+            template<typename T> static FP_REAL_DEVICE constexpr lane_interval<T> interval(const lane_interval<T> l, const lane_interval<T> r) noexcept {
+                return { next_down(static_cast<T>(l._lo + r._lo)), next_up(static_cast<T>(l._hi + r._hi)) };
+            }
+        };
+        struct sub_op {
+            static constexpr Deferred::Op tape_op{ Deferred::Op::Sub };
+            static constexpr Deferred::Op tape_op_literal{ Deferred::Op::SubLiteral };
+            template<typename T> static FP_REAL_DEVICE constexpr T apply(const T l, const T r) noexcept { return (l - r); }
+            template<typename T> static FP_REAL_DEVICE constexpr T bound(const T, const T, const T bl, const T br, const T result) noexcept {
+                return (bl + br + half_ulp<T>() * bound_abs(result));
+            }
+            template<typename T> static FP_REAL_DEVICE constexpr lane_interval<T> interval(const lane_interval<T> l, const lane_interval<T> r) noexcept {
+                return { next_down(static_cast<T>(l._lo - r._hi)), next_up(static_cast<T>(l._hi - r._lo)) };
+            }
+        };
+        struct mul_op {
+            static constexpr Deferred::Op tape_op{ Deferred::Op::Mul };
+            static constexpr Deferred::Op tape_op_literal{ Deferred::Op::MulLiteral };
+            template<typename T> static FP_REAL_DEVICE constexpr T apply(const T l, const T r) noexcept { return (l * r); }
+            template<typename T> static FP_REAL_DEVICE constexpr T bound(const T l, const T r, const T bl, const T br, const T result) noexcept {
+                return (bound_abs(l) * br + bound_abs(r) * bl + half_ulp<T>() * bound_abs(result));
+            }
+            template<typename T> static FP_REAL_DEVICE constexpr lane_interval<T> interval(const lane_interval<T> l, const lane_interval<T> r) noexcept {
+                const T candidates[4]{ static_cast<T>(l._lo * r._lo), static_cast<T>(l._lo * r._hi),
+                                       static_cast<T>(l._hi * r._lo), static_cast<T>(l._hi * r._hi) };
+                T lo{ candidates[0] };
+                T hi{ candidates[0] };
+                for (std::size_t i{ 1 }; i < 4; ++i) {
+                    lo = (candidates[i] < lo) ? candidates[i] : lo;
+                    hi = (candidates[i] > hi) ? candidates[i] : hi;
+                }
+                return { next_down(lo), next_up(hi) };
+            }
+        };
+        struct div_op {
+            static constexpr Deferred::Op tape_op{ Deferred::Op::Div };
+            static constexpr Deferred::Op tape_op_literal{ Deferred::Op::DivLiteral };
+            template<typename T> static FP_REAL_DEVICE constexpr T apply(const T l, const T r) noexcept { return (l / r); }
+            template<typename T> static FP_REAL_DEVICE constexpr T bound(const T, const T r, const T bl, const T br, const T result) noexcept {
+                return ((bl + bound_abs(result) * br) / bound_abs(r) + half_ulp<T>() * bound_abs(result));
+            }
+            template<typename T> static FP_REAL_DEVICE constexpr lane_interval<T> interval(const lane_interval<T> l, const lane_interval<T> r) noexcept {
+                if ((r._lo <= T(0)) && (r._hi >= T(0))) {       // divisor enclosure straddles zero
+                    return { -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity() };
+                }
+                const T candidates[4]{ static_cast<T>(l._lo / r._lo), static_cast<T>(l._lo / r._hi),
+                                       static_cast<T>(l._hi / r._lo), static_cast<T>(l._hi / r._hi) };
+                T lo{ candidates[0] };
+                T hi{ candidates[0] };
+                for (std::size_t i{ 1 }; i < 4; ++i) {
+                    lo = (candidates[i] < lo) ? candidates[i] : lo;
+                    hi = (candidates[i] > hi) ? candidates[i] : hi;
+                }
+                return { next_down(lo), next_up(hi) };
+            }
+        };
+
+        // extract an operand's running error bound (scalars are exact)
+        template<typename TYPE, typename T> FP_REAL_DEVICE constexpr TYPE bound_of(const T& xi_operand) noexcept {
+            if constexpr (std::is_arithmetic<T>::value) {
+                return TYPE(0);
+            }
+            else {
+                return static_cast<TYPE>(xi_operand.bound());
+            }
+        }
+
+        // extract an operand's enclosure (scalars are treated as exact points)
+        template<typename TYPE, typename T> FP_REAL_DEVICE constexpr lane_interval<TYPE> interval_of(const T& xi_operand) noexcept {
+            if constexpr (std::is_arithmetic<T>::value) {
+                const TYPE point{ static_cast<TYPE>(xi_operand) };
+                return { point, point };
+            }
+            else {
+                return xi_operand.interval();
+            }
+        }
+
+        // is T a multiplication expression node? (candidate for fused multiply-add contraction)
+        template<typename T> struct is_mul_expression : std::false_type {};
+        template<Precision P, Compare C, typename LHS, typename RHS> struct is_mul_expression<RealExpression<P, C, mul_op, LHS, RHS>> : std::true_type {};
+
+        // is T a Real itself (and not an expression node)?
+        template<typename T> struct is_real_leaf {
+            static constexpr bool value{ operand_traits<std::decay_t<T>>::is_real && !is_expression<std::decay_t<T>>::value };
+        };
+
+        // are both operands plain Real leaves of different precisions? (such calls
+        // collapse through the generic function overloads, since the concrete ones
+        // share one precision for all arguments)
+        template<typename LHS, typename RHS> FP_REAL_DEVICE constexpr bool mixed_real_leaves() {
+            if constexpr (is_real_leaf<std::decay_t<LHS>>::value && is_real_leaf<std::decay_t<RHS>>::value) {
+                return (operand_traits<std::decay_t<LHS>>::precision != operand_traits<std::decay_t<RHS>>::precision);
+            }
+            else {
+                return false;
+            }
+        }
+
+        // can A, B and ADDEND form one ternary (fused multiply-add) expression?
+        // (each operand must be a scalar or a Real/expression of one common precision
+        //  & comparison mode, and at least one operand must be a Real/expression)
+        template<typename A, typename B, typename ADDEND> FP_REAL_DEVICE constexpr bool ternary_valid() {
+            if constexpr (operand_traits<std::decay_t<A>>::is_real) {
+                return (expression_valid<A, B>() && expression_valid<A, ADDEND>());
+            }
+            else if constexpr (operand_traits<std::decay_t<B>>::is_real) {
+                return (operand_traits<std::decay_t<A>>::is_scalar && expression_valid<B, ADDEND>());
+            }
+            else if constexpr (operand_traits<std::decay_t<ADDEND>>::is_real) {
+                return (operand_traits<std::decay_t<A>>::is_scalar && operand_traits<std::decay_t<B>>::is_scalar);
+            }
+            else {
+                return false;
+            }
+        }
+
+        // precision/compare of the Real a ternary expression evaluates to
+        template<typename A, typename B, typename ADDEND> FP_REAL_DEVICE constexpr Precision pick_precision3() {
+            if constexpr (operand_traits<std::decay_t<A>>::is_real) {
+                if constexpr (operand_traits<std::decay_t<B>>::is_real || operand_traits<std::decay_t<ADDEND>>::is_real) {
+                    return wider_precision<operand_traits<std::decay_t<A>>::precision, pick_precision<B, ADDEND>()>();
+                }
+                else {
+                    return operand_traits<std::decay_t<A>>::precision;
+                }
+            }
+            else {
+                return pick_precision<B, ADDEND>();
+            }
+        }
+        template<typename A, typename B, typename ADDEND> FP_REAL_DEVICE constexpr Compare pick_compare3() {
+            if constexpr (operand_traits<std::decay_t<A>>::is_real) {
+                return operand_traits<std::decay_t<A>>::compare;
+            }
+            else {
+                return pick_compare<B, ADDEND>();
+            }
+        }
+
+        // should 'a * b + c' expressions be contracted into fused multiply-add?
+        // (opt-in, since contraction skips the intermediate rounding and therefore
+        //  changes bit-exact results - same trade-off as the compiler's -ffp-contract)
+#if defined(FP_REAL_CONTRACT_FMA)
+        inline constexpr bool contract_fma{ true };
+#else
+        inline constexpr bool contract_fma{ false };
+#endif
+    }
+
+    /**
+    * \brief an object which can be either float or double, and if it is a float - can be used for
+    *        numerical accuracy estimation.
+    *
+    * @param {Precision, in} precision of 'used' type (either single or double; single by default)
+    * @param {Compare,   in} should an accuracy comparison be made between single & double precision? (no by default)
+    **/
+    template<Precision PRECISION = Precision::Single, Compare COMPARE = Compare::No> class Real {
+
+        // internal helpers
+        private:
+
+            // extract an enum class underlying type
+            template<typename ENUM> static FP_REAL_DEVICE constexpr typename std::underlying_type<ENUM>::type ToType(ENUM xi_enum) { 
+                return static_cast<typename std::underlying_type<ENUM>::type>(xi_enum);
+            }
+
+        // aliases needed outside this class
+        public:
+            // alias for underlying type
+            using TYPE = detail::precision_type_t<PRECISION>;
+
+        // internal structure
+        private:
+
+            // structure holding a floating point variable to be used regularly
+            struct regularStruct {
+                // properties
+                TYPE _value;    // used value
+
+                // constructor
+                FP_REAL_DEVICE constexpr regularStruct() = default;
+                FP_REAL_DEVICE constexpr regularStruct(TYPE v)                     : _value(v)                   {}
+                FP_REAL_DEVICE constexpr regularStruct(const regularStruct&)            = default;
+                FP_REAL_DEVICE constexpr regularStruct(regularStruct&&) noexcept        = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr regularStruct(const U v) : _value(static_cast<double>(v)) {}
+
+                // assignment
+                FP_REAL_DEVICE constexpr regularStruct& operator=(const regularStruct&)     = default;
+                FP_REAL_DEVICE constexpr regularStruct& operator=(regularStruct&&) noexcept = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr regularStruct& operator=(const U v) {
+                    _value = static_cast<TYPE>(v);
+                    return *this;
+                }
+            };
+
+            // structure holding both single and double floating point variables for comparison
+            struct compareStruct {
+                // properties
+                TYPE _value;        // used value
+                double _exact;      // 'exact' value (for comparison)
+
+                // constructor
+                FP_REAL_DEVICE constexpr compareStruct() = default;
+                FP_REAL_DEVICE constexpr compareStruct(const TYPE v)               : _value(v),                   _exact(static_cast<double>(v)) {}         
+                FP_REAL_DEVICE constexpr compareStruct(const compareStruct&)            = default;
+                FP_REAL_DEVICE constexpr compareStruct(compareStruct&&) noexcept        = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr compareStruct(const TYPE v, const U e) : _value(v), _exact(static_cast<double>(e)) {}
+
+                // assignment
+                FP_REAL_DEVICE constexpr compareStruct& operator=(const compareStruct&)     = default;
+                FP_REAL_DEVICE constexpr compareStruct& operator=(compareStruct&&) noexcept = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr compareStruct& operator=(const U v) {
+                    _value = static_cast<TYPE>(v);
+                    _exact = static_cast<double>(v);
+                    return *this;
+                }
+            };
+
+            // structure holding a floating point variable together with a running upper
+            // bound on its accumulated rounding error (see Compare::Bound)
+            struct boundStruct {
+                // properties
+                TYPE _value;    // used value
+                TYPE _bound;    // running upper bound on |exact - value|
+
+                // constructor
+                FP_REAL_DEVICE constexpr boundStruct() = default;
+                FP_REAL_DEVICE constexpr boundStruct(const TYPE v)               : _value(v),                   _bound(TYPE(0))               {}
+                FP_REAL_DEVICE constexpr boundStruct(const boundStruct&)            = default;
+                FP_REAL_DEVICE constexpr boundStruct(boundStruct&&) noexcept        = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr boundStruct(const TYPE v, const U b) : _value(v), _bound(static_cast<TYPE>(b)) {}
+
+                // assignment
+                FP_REAL_DEVICE constexpr boundStruct& operator=(const boundStruct&)     = default;
+                FP_REAL_DEVICE constexpr boundStruct& operator=(boundStruct&&) noexcept = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr boundStruct& operator=(const U v) {
+                    _value = static_cast<TYPE>(v);
+                    _bound = TYPE(0);
+                    return *this;
+                }
+            };
+
+            // structure holding a floating point variable together with a guaranteed
+            // enclosure [lo, hi] of its exact value (see Compare::Interval)
+            struct intervalStruct {
+                // properties
+                TYPE _value;    // used value
+                TYPE _lo;       // lower endpoint of the enclosure
+                TYPE _hi;       // upper endpoint of the enclosure
+
+                // constructor
+                FP_REAL_DEVICE constexpr intervalStruct() = default;
+                FP_REAL_DEVICE constexpr intervalStruct(const TYPE v)               : _value(v), _lo(v), _hi(v) {}
+                FP_REAL_DEVICE constexpr intervalStruct(const intervalStruct&)            = default;
+                FP_REAL_DEVICE constexpr intervalStruct(intervalStruct&&) noexcept        = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr intervalStruct(const TYPE v, const U lo, const U hi) : _value(v), _lo(static_cast<TYPE>(lo)), _hi(static_cast<TYPE>(hi)) {}
+
+                // assignment
+                FP_REAL_DEVICE constexpr intervalStruct& operator=(const intervalStruct&)     = default;
+                FP_REAL_DEVICE constexpr intervalStruct& operator=(intervalStruct&&) noexcept = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                FP_REAL_DEVICE constexpr intervalStruct& operator=(const U v) {
+                    _value = static_cast<TYPE>(v);
+                    _lo    = _value;
+                    _hi    = _value;
+                    return *this;
+                }
+            };
+
+        // properties
+        private:
+
+            // value and its defining tape record (deferred comparison analysis)
+            struct deferredStruct {
+                // properties
+                TYPE _value;            // used value
+                std::uint32_t _id;      // id of the tape record defining this value (see Real/deferred.h)
+
+                // constructor (every entry point records, so the id is never stale;
+                // recording is inherently a runtime act, hence no constexpr here)
+                deferredStruct() : _value(TYPE(0)), _id(Deferred::tape().literal(0.0)) {}
+                deferredStruct(const TYPE v) : _value(v), _id(Deferred::tape().literal(static_cast<double>(v))) {}
+                FP_REAL_DEVICE constexpr deferredStruct(const TYPE v, const std::uint32_t id) : _value(v), _id(id) {}
+                FP_REAL_DEVICE constexpr deferredStruct(const deferredStruct&)            = default;
+                FP_REAL_DEVICE constexpr deferredStruct(deferredStruct&&) noexcept        = default;
+
+                // assignment
+                FP_REAL_DEVICE constexpr deferredStruct& operator=(const deferredStruct&)     = default;
+                FP_REAL_DEVICE constexpr deferredStruct& operator=(deferredStruct&&) noexcept = default;
+
+                template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+                deferredStruct& operator=(const U v) {
+                    _value = static_cast<TYPE>(v);
+                    _id    = Deferred::tape().literal(static_cast<double>(v));
+                    return *this;
+                }
+            };
+
+            // alias for functional type
+            using PROPERTY_TYPE = typename std::conditional<(COMPARE == Compare::Yes) || (COMPARE == Compare::Trap), compareStruct,
+                                  typename std::conditional<COMPARE == Compare::Bound,    boundStruct,
+                                  typename std::conditional<COMPARE == Compare::Deferred, deferredStruct,
+                                  typename std::conditional<COMPARE == Compare::Interval, intervalStruct, regularStruct>::type>::type>::type>::type;
+
+            // used value
+            PROPERTY_TYPE m_value;
+
+        // constructor
+        public:
+
+            // constructor for non comparison analysis
+            FP_REAL_DEVICE constexpr Real()       : m_value()  {}
+            FP_REAL_DEVICE constexpr Real(TYPE v) : m_value(v) {}
+
+            // constructor for comparison/bound analysis (second argument is the 'exact'
+            // value in Compare::Yes mode, the initial error bound in Compare::Bound mode)
+            template<typename U, Compare C = COMPARE, typename = std::enable_if_t<((C == Compare::Yes) || (C == Compare::Bound) || (C == Compare::Trap)) && std::is_arithmetic<U>::value>>
+            FP_REAL_DEVICE constexpr Real(const TYPE v, const U e) : m_value(v, e) {}
+
+            // constructor binding a value to an existing tape record (deferred mode)
+            template<Compare C = COMPARE, typename = std::enable_if_t<C == Compare::Deferred>>
+            FP_REAL_DEVICE constexpr Real(const TYPE v, const std::uint32_t xi_id) : m_value(v, xi_id) {}
+
+            // constructor for interval mode (explicit enclosure endpoints)
+            template<typename U, Compare C = COMPARE, typename = std::enable_if_t<(C == Compare::Interval) && std::is_arithmetic<U>::value>, typename = void>
+            FP_REAL_DEVICE constexpr Real(const TYPE v, const U lo, const U hi) : m_value(v, lo, hi) {}
+
+            // constructor from an expression (the whole chain is fused and evaluated here)
+            template<typename E, typename = std::enable_if_t<detail::is_expression_of<E, PRECISION, COMPARE>::value>>
+            FP_REAL_DEVICE constexpr Real(const E& xi_expression) {
+                m_value._value = xi_expression.value();
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_value._exact = xi_expression.exact();
+                    M_REAL_RECORD(m_value._value, m_value._exact);
+                }
+                else if constexpr (COMPARE == Compare::Trap) {
+                    m_value._exact = xi_expression.exact();
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);
+                }
+                else if constexpr (COMPARE == Compare::Bound) {
+                    m_value._bound = xi_expression.bound();
+                }
+                else if constexpr (COMPARE == Compare::Deferred) {
+                    m_value._id = xi_expression.record();
+                }
+                else if constexpr (COMPARE == Compare::Interval) {
+                    const detail::lane_interval<TYPE> enclosure{ xi_expression.interval() };
+                    m_value._lo = enclosure._lo;
+                    m_value._hi = enclosure._hi;
+                }
+            }
+
+            // converting constructors between precisions of the same comparison mode;
+            // widening is implicit and exact (standard promotion semantics; the 'exact'
+            // lane carries over untouched), narrowing is explicit - and in Compare::Bound
+            // mode the rounding of the conversion itself is added to the carried bound
+            template<Precision P, typename = std::enable_if_t<(P != PRECISION) && (sizeof(detail::precision_type_t<P>) < sizeof(detail::precision_type_t<PRECISION>))>>
+            FP_REAL_DEVICE constexpr Real(const Real<P, COMPARE>& r) {
+                m_value._value = static_cast<TYPE>(r.value());
+
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    m_value._exact = r.exact();
+                }
+                else if constexpr (COMPARE == Compare::Bound) {
+                    m_value._bound = static_cast<TYPE>(r.bound());
+                }
+                else if constexpr (COMPARE == Compare::Interval) {
+                    m_value._lo = static_cast<TYPE>(r.lo());
+                    m_value._hi = static_cast<TYPE>(r.hi());
+                }
+            }
+
+            template<Precision P, typename = std::enable_if_t<(P != PRECISION) && (sizeof(detail::precision_type_t<P>) >= sizeof(detail::precision_type_t<PRECISION>))>, typename = void>
+            FP_REAL_DEVICE constexpr explicit Real(const Real<P, COMPARE>& r) {
+                m_value._value = static_cast<TYPE>(r.value());
+
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    m_value._exact = r.exact();
+                }
+                else if constexpr (COMPARE == Compare::Bound) {
+                    m_value._bound = static_cast<TYPE>(r.bound()) + detail::half_ulp<TYPE>() * detail::bound_abs(m_value._value);
+                }
+                else if constexpr (COMPARE == Compare::Interval) {
+                    // the narrowing casts round to nearest; nudge outward to stay an enclosure
+                    m_value._lo = detail::next_down(static_cast<TYPE>(r.lo()));
+                    m_value._hi = detail::next_up(static_cast<TYPE>(r.hi()));
+                }
+            }
+
+            // copy/move semantics (defaulted, so Real stays trivially copyable and
+            // buffers of it can be snapshot with one memcpy/write - see Serialize.h)
+            FP_REAL_DEVICE constexpr Real(const Real&)     = default;
+            FP_REAL_DEVICE constexpr Real(Real&&) noexcept = default;
+
+            // assignment
+            FP_REAL_DEVICE constexpr Real& operator=(const Real&)     = default;
+            FP_REAL_DEVICE constexpr Real& operator=(Real&&) noexcept = default;
+
+            template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+            FP_REAL_DEVICE constexpr Real& operator=(const U v) {
+                m_value = static_cast<TYPE>(v);
+                return *this;
+            }
+
+            // assignment from an expression (the whole chain is fused and evaluated here)
+            template<typename E, typename = std::enable_if_t<detail::is_expression_of<E, PRECISION, COMPARE>::value>>
+            FP_REAL_DEVICE constexpr Real& operator=(const E& xi_expression) {
+                m_value._value = xi_expression.value();
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_value._exact = xi_expression.exact();
+                    M_REAL_RECORD(m_value._value, m_value._exact);
+                }
+                else if constexpr (COMPARE == Compare::Trap) {
+                    m_value._exact = xi_expression.exact();
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);
+                }
+                else if constexpr (COMPARE == Compare::Bound) {
+                    m_value._bound = xi_expression.bound();
+                }
+                else if constexpr (COMPARE == Compare::Deferred) {
+                    m_value._id = xi_expression.record();
+                }
+                else if constexpr (COMPARE == Compare::Interval) {
+                    const detail::lane_interval<TYPE> enclosure{ xi_expression.interval() };
+                    m_value._lo = enclosure._lo;
+                    m_value._hi = enclosure._hi;
+                }
+
+                return *this;
+            }
+
+        // getters
+        public:
+
+            // return underlying struct
+            FP_REAL_DEVICE constexpr TYPE value() const noexcept { return m_value._value; }
+
+            // return 'exact' value
+            template<Compare T = COMPARE, typename = std::enable_if_t<(T == Compare::Yes) || (T == Compare::Trap)>>
+            FP_REAL_DEVICE constexpr double exact() const noexcept { return m_value._exact; }
+
+            // return error between double and single precision calculations
+            template<Compare T = COMPARE, typename = std::enable_if<(T == Compare::Yes) || (T == Compare::Trap)>>
+            FP_REAL_DEVICE constexpr double error() const noexcept { return (exact() - static_cast<double>(value())); }
+
+            // return the running upper bound on |exact - value|
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Bound>>
+            FP_REAL_DEVICE constexpr TYPE bound() const noexcept { return m_value._bound; }
+
+            // return the id of the tape record defining this value (deferred mode;
+            // index into FP::replay()'s output)
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Deferred>>
+            FP_REAL_DEVICE constexpr std::uint32_t id() const noexcept { return m_value._id; }
+
+            // return the enclosure endpoints (interval mode; the exact value is
+            // guaranteed to lie within [lo, hi])
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Interval>>
+            FP_REAL_DEVICE constexpr TYPE lo() const noexcept { return m_value._lo; }
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Interval>>
+            FP_REAL_DEVICE constexpr TYPE hi() const noexcept { return m_value._hi; }
+
+            // return the enclosure as one lane pair (used by the expression machinery)
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Interval>>
+            FP_REAL_DEVICE constexpr detail::lane_interval<TYPE> interval() const noexcept { return { m_value._lo, m_value._hi }; }
+
+            // return the 'used' lane as a monotonically ordered unsigned key - the
+            // value's bit pattern with the sign folded so that integer comparison of
+            // keys matches floating point comparison of values (NaN keys sort above
+            // +infinity); radix pipelines sort on it (see RealSort.h)
+            FP_REAL_DEVICE constexpr detail::lane_bits_t<TYPE> to_ordered_bits() const noexcept {
+                using BITS = detail::lane_bits_t<TYPE>;
+                constexpr BITS sign_mask{ static_cast<BITS>(BITS(1) << (sizeof(BITS) * 8 - 1)) };
+                const BITS bits{ std::bit_cast<BITS>(m_value._value) };
+                return (((bits & sign_mask) != 0) ? static_cast<BITS>(~bits) : static_cast<BITS>(bits | sign_mask));
+            }
+
+        // stream
+        public:
+
+            /**
+            * \brief write the textual form of this Real into a caller supplied buffer,
+            *        without allocating (std::to_chars based).
+            *
+            * @param {char*, in/out} first character of the destination buffer
+            * @param {char*, in}     one past the last character of the destination buffer
+            * @param {char*, out}    one past the last written character
+            **/
+            char* to_chars(char* xio_first, char* const xi_last) const noexcept {
+                // std::to_chars has no 16bit overloads; those are widened to float for printing
+                using PRINTABLE = typename std::conditional<(sizeof(TYPE) < sizeof(float)), float, TYPE>::type;
+
+                const auto write = [xi_last](char* xio_ptr, const char* xi_text) {
+                    while ((*xi_text != '\0') && (xio_ptr != xi_last)) {
+                        *xio_ptr++ = *xi_text++;
+                    }
+                    return xio_ptr;
+                };
+
+                // a number; on value_too_large (fixed notation of a large magnitude can
+                // outgrow any reasonable buffer) fall back to scientific, whose length is
+                // bounded - never advance past an errored conversion, its bytes are garbage
+                const auto put = [xi_last](char* xio_ptr, const auto xi_number, const std::chars_format xi_format, const int xi_precision) {
+                    const std::to_chars_result attempt{ std::to_chars(xio_ptr, xi_last, xi_number, xi_format, xi_precision) };
+                    if (attempt.ec == std::errc()) {
+                        return attempt.ptr;
+                    }
+                    const std::to_chars_result fallback{ std::to_chars(xio_ptr, xi_last, xi_number, std::chars_format::scientific, xi_precision) };
+                    return ((fallback.ec == std::errc()) ? fallback.ptr : xio_ptr);
+                };
+
+                if constexpr ((COMPARE == Compare::Yes) || (COMPARE == Compare::Trap)) {
+                    xio_first = write(xio_first, "{value = ");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(value()), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, ", exact value = ");
+                    xio_first = put(xio_first, exact(), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, ", error = ");
+                    xio_first = put(xio_first, error(), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, "}");
+                }
+                else if constexpr (COMPARE == Compare::Bound) {
+                    xio_first = write(xio_first, "{value = ");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(value()), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, ", error bound = ");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(bound()), std::chars_format::scientific, 3);
+                    xio_first = write(xio_first, "}");
+                }
+                else if constexpr (COMPARE == Compare::Interval) {
+                    xio_first = write(xio_first, "{value = ");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(value()), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, ", enclosure = [");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(lo()), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, ", ");
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(hi()), std::chars_format::fixed, 6);
+                    xio_first = write(xio_first, "]}");
+                }
+                else {
+                    xio_first = put(xio_first, static_cast<PRINTABLE>(value()), std::chars_format::fixed, 6);
+                }
+
+                return xio_first;
+            }
+
+
+        // numerical assignment operator overloading
+        public:
+
+#define M_ASSIGNMENT_OPERATOR(OP, TAG)                                                                         \
+            FP_REAL_DEVICE constexpr Real& operator OP (const TYPE xi_value) {                                                \
+                const TYPE lhs{ m_value._value };                                                              \
+                m_value._value OP xi_value;                                                                    \
+                                                                                                               \
+                if constexpr (COMPARE == Compare::Yes) {                                                       \
+                    m_value._exact OP static_cast<double>(xi_value);                                           \
+                    M_REAL_RECORD(m_value._value, m_value._exact);                                             \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Trap) {                                                 \
+                    m_value._exact OP static_cast<double>(xi_value);                                           \
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Bound) {                                                \
+                    m_value._bound = detail::TAG::bound(lhs, xi_value, m_value._bound, TYPE(0), m_value._value); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Deferred) {                                             \
+                    m_value._id = Deferred::tape().binary_literal(detail::TAG::tape_op_literal, m_value._id, static_cast<double>(xi_value)); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Interval) {                                             \
+                    const detail::lane_interval<TYPE> enclosure{ detail::TAG::interval(detail::lane_interval<TYPE>{ m_value._lo, m_value._hi },   \
+                                                                                       detail::lane_interval<TYPE>{ xi_value, xi_value }) };     \
+                    m_value._lo = enclosure._lo;                                                               \
+                    m_value._hi = enclosure._hi;                                                               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Stochastic) {                                           \
+                    m_value._value = detail::perturb(m_value._value);                                          \
+                }                                                                                              \
+                                                                                                               \
+                return *this;                                                                                  \
+            }                                                                                                  \
+            FP_REAL_DEVICE constexpr Real& operator OP (const Real& xi_value) {                                               \
+                const TYPE lhs{ m_value._value };                                                              \
+                m_value._value OP xi_value.value();                                                            \
+                                                                                                               \
+                if constexpr (COMPARE == Compare::Yes) {                                                       \
+                    m_value._exact OP xi_value.exact();                                                        \
+                    M_REAL_RECORD(m_value._value, m_value._exact);                                             \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Trap) {                                                 \
+                    m_value._exact OP xi_value.exact();                                                        \
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Bound) {                                                \
+                    m_value._bound = detail::TAG::bound(lhs, xi_value.value(), m_value._bound, xi_value.bound(), m_value._value); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Deferred) {                                             \
+                    m_value._id = Deferred::tape().binary(detail::TAG::tape_op, m_value._id, xi_value.id());   \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Interval) {                                             \
+                    const detail::lane_interval<TYPE> enclosure{ detail::TAG::interval(detail::lane_interval<TYPE>{ m_value._lo, m_value._hi },   \
+                                                                                       xi_value.interval()) }; \
+                    m_value._lo = enclosure._lo;                                                               \
+                    m_value._hi = enclosure._hi;                                                               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Stochastic) {                                           \
+                    m_value._value = detail::perturb(m_value._value);                                          \
+                }                                                                                              \
+                                                                                                               \
+                return *this;                                                                                  \
+            }                                                                                                  \
+            FP_REAL_DEVICE constexpr Real& operator OP (Real&& xi_value) {                                                    \
+                const TYPE lhs{ m_value._value };                                                              \
+                m_value._value OP std::move(xi_value.value());                                                 \
+                                                                                                               \
+                if constexpr (COMPARE == Compare::Yes) {                                                       \
+                    m_value._exact OP std::move(xi_value.exact());                                             \
+                    M_REAL_RECORD(m_value._value, m_value._exact);                                             \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Trap) {                                                 \
+                    m_value._exact OP xi_value.exact();                                                        \
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Bound) {                                                \
+                    m_value._bound = detail::TAG::bound(lhs, xi_value.value(), m_value._bound, xi_value.bound(), m_value._value); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Deferred) {                                             \
+                    m_value._id = Deferred::tape().binary(detail::TAG::tape_op, m_value._id, xi_value.id());   \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Interval) {                                             \
+                    const detail::lane_interval<TYPE> enclosure{ detail::TAG::interval(detail::lane_interval<TYPE>{ m_value._lo, m_value._hi },   \
+                                                                                       xi_value.interval()) }; \
+                    m_value._lo = enclosure._lo;                                                               \
+                    m_value._hi = enclosure._hi;                                                               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Stochastic) {                                           \
+                    m_value._value = detail::perturb(m_value._value);                                          \
+                }                                                                                              \
+                                                                                                               \
+                return *this;                                                                                  \
+            }                                                                                                  \
+            template<typename E, typename = std::enable_if_t<detail::is_expression_of<E, PRECISION, COMPARE>::value>> \
+            FP_REAL_DEVICE constexpr Real& operator OP (const E& xi_expression) {                                             \
+                const TYPE lhs{ m_value._value };                                                              \
+                const TYPE rhs{ xi_expression.value() };                                                       \
+                m_value._value OP rhs;                                                                         \
+                                                                                                               \
+                if constexpr (COMPARE == Compare::Yes) {                                                       \
+                    m_value._exact OP xi_expression.exact();                                                   \
+                    M_REAL_RECORD(m_value._value, m_value._exact);                                             \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Trap) {                                                 \
+                    m_value._exact OP xi_expression.exact();                                                   \
+                    Trap::check<PRECISION>(static_cast<double>(m_value._value), m_value._exact);               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Bound) {                                                \
+                    m_value._bound = detail::TAG::bound(lhs, rhs, m_value._bound, xi_expression.bound(), m_value._value); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Deferred) {                                             \
+                    m_value._id = Deferred::tape().binary(detail::TAG::tape_op, m_value._id, xi_expression.record()); \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Interval) {                                             \
+                    const detail::lane_interval<TYPE> enclosure{ detail::TAG::interval(detail::lane_interval<TYPE>{ m_value._lo, m_value._hi },   \
+                                                                                       xi_expression.interval()) }; \
+                    m_value._lo = enclosure._lo;                                                               \
+                    m_value._hi = enclosure._hi;                                                               \
+                }                                                                                              \
+                else if constexpr (COMPARE == Compare::Stochastic) {                                           \
+                    m_value._value = detail::perturb(m_value._value);                                          \
+                }                                                                                              \
+                                                                                                               \
+                return *this;                                                                                  \
+            }
+
+            M_ASSIGNMENT_OPERATOR(+=, add_op);
+            M_ASSIGNMENT_OPERATOR(-=, sub_op);
+            M_ASSIGNMENT_OPERATOR(*=, mul_op);
+            M_ASSIGNMENT_OPERATOR(/=, div_op);
+
+#undef M_ASSIGNMENT_OPERATOR
+    };
+
+    // checkpointing relies on Real being one memcpy-able lump of lanes in every
+    // configuration (see Serialize.h); lock that property in
+    static_assert(std::is_trivially_copyable<Real<Precision::Single, Compare::No>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Single, Compare::Yes>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Single, Compare::Bound>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Single, Compare::Interval>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Double, Compare::No>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Double, Compare::Yes>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Double, Compare::Bound>>::value &&
+                  std::is_trivially_copyable<Real<Precision::Double, Compare::Interval>>::value,
+                  "Real: must stay trivially copyable (buffers of it are snapshot with raw writes).");
+
+    /**
+    * \brief a lightweight expression node over two operands (Real's, nested expressions or scalars).
+    *        binary operators build a tree of these nodes instead of materializing a Real per
+    *        intermediate; the whole chain is evaluated - lane by lane - only when assigned
+    *        (or converted) to a Real, so long arithmetic expressions compile down to
+    *        register-only code, in comparison mode as well.
+    *
+    * @param {Precision, in} precision of the Real this expression evaluates to
+    * @param {Compare,   in} comparison mode of the Real this expression evaluates to
+    * @param {OP,        in} operation tag (see detail::add_op and friends)
+    * @param {LHS,       in} left hand side operand type
+    * @param {RHS,       in} right hand side operand type
+    **/
+    template<Precision P, Compare C, typename OP, typename LHS, typename RHS> struct RealExpression {
+        // alias for underlying type
+        using TYPE = typename Real<P, C>::TYPE;
+
+        // properties (operands are held by value; nodes are small and live in registers)
+        LHS m_lhs;      // left hand side operand
+        RHS m_rhs;      // right hand side operand
+
+        // constructor
+        FP_REAL_DEVICE constexpr RealExpression(const LHS& xi_lhs, const RHS& xi_rhs) noexcept : m_lhs(xi_lhs), m_rhs(xi_rhs) {}
+
+        // evaluate the 'used' lane (in stochastic mode every node of the chain
+        // perturbs its own rounding, so lazy evaluation estimates like eager code)
+        FP_REAL_DEVICE constexpr TYPE value() const noexcept {
+            if constexpr (C == Compare::Stochastic) {
+                return detail::perturb(OP::apply(detail::value_of<TYPE>(m_lhs), detail::value_of<TYPE>(m_rhs)));
+            }
+            else {
+                return OP::apply(detail::value_of<TYPE>(m_lhs), detail::value_of<TYPE>(m_rhs));
+            }
+        }
+
+        // evaluate the 'exact' lane
+        template<Compare T = C, typename = std::enable_if_t<(T == Compare::Yes) || (T == Compare::Trap)>>
+        FP_REAL_DEVICE constexpr double exact() const noexcept {
+            return OP::apply(detail::exact_of(m_lhs), detail::exact_of(m_rhs));
+        }
+
+        // evaluate the running error bound
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Bound>>
+        FP_REAL_DEVICE constexpr TYPE bound() const noexcept {
+            return OP::bound(detail::value_of<TYPE>(m_lhs), detail::value_of<TYPE>(m_rhs),
+                             detail::bound_of<TYPE>(m_lhs), detail::bound_of<TYPE>(m_rhs), value());
+        }
+
+        // record this node (and its operand subtrees) onto the calling thread's tape
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Deferred>>
+        std::uint32_t record() const {
+            const std::uint32_t lhs{ detail::id_of(m_lhs) };
+            const std::uint32_t rhs{ detail::id_of(m_rhs) };
+            return Deferred::tape().binary(OP::tape_op, lhs, rhs);
+        }
+
+        // evaluate the enclosure
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Interval>>
+        FP_REAL_DEVICE constexpr detail::lane_interval<TYPE> interval() const noexcept {
+            return OP::interval(detail::interval_of<TYPE>(m_lhs), detail::interval_of<TYPE>(m_rhs));
+        }
+    };
+
+    /**
+    * \brief a fused multiply-add expression node (a * b + c in one rounded operation,
+    *        on both lanes). built either explicitly via FP::fma or - when
+    *        FP_REAL_CONTRACT_FMA is defined - by contracting 'a * b + c' chains.
+    *
+    * @param {Precision, in} precision of the Real this expression evaluates to
+    * @param {Compare,   in} comparison mode of the Real this expression evaluates to
+    * @param {A,         in} first multiplicand operand type
+    * @param {B,         in} second multiplicand operand type
+    * @param {ADDEND,    in} addend operand type
+    **/
+    template<Precision P, Compare C, typename A, typename B, typename ADDEND> struct RealFmaExpression {
+        // alias for underlying type
+        using TYPE = typename Real<P, C>::TYPE;
+
+        // properties
+        A m_a;              // first multiplicand
+        B m_b;              // second multiplicand
+        ADDEND m_addend;    // addend
+
+        // constructor
+        FP_REAL_DEVICE constexpr RealFmaExpression(const A& xi_a, const B& xi_b, const ADDEND& xi_addend) noexcept : m_a(xi_a), m_b(xi_b), m_addend(xi_addend) {}
+
+        // evaluate the 'used' lane
+        FP_REAL_DEVICE TYPE value() const noexcept {
+            const TYPE result{ static_cast<TYPE>(std::fma(detail::math_arg(detail::value_of<TYPE>(m_a)), detail::math_arg(detail::value_of<TYPE>(m_b)), detail::math_arg(detail::value_of<TYPE>(m_addend)))) };
+            if constexpr (C == Compare::Stochastic) {
+                return detail::perturb(result);
+            }
+            else {
+                return result;
+            }
+        }
+
+        // evaluate the 'exact' lane
+        template<Compare T = C, typename = std::enable_if_t<(T == Compare::Yes) || (T == Compare::Trap)>>
+        FP_REAL_DEVICE double exact() const noexcept {
+            return std::fma(detail::exact_of(m_a), detail::exact_of(m_b), detail::exact_of(m_addend));
+        }
+
+        // evaluate the running error bound (multiply propagation plus the addend's
+        // bound; the fused operation itself rounds once)
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Bound>>
+        FP_REAL_DEVICE TYPE bound() const noexcept {
+            const TYPE a{ detail::value_of<TYPE>(m_a) };
+            const TYPE b{ detail::value_of<TYPE>(m_b) };
+            const TYPE result{ value() };
+            return (detail::bound_abs(a) * detail::bound_of<TYPE>(m_b) +
+                    detail::bound_abs(b) * detail::bound_of<TYPE>(m_a) +
+                    detail::bound_of<TYPE>(m_addend) +
+                    detail::half_ulp<TYPE>() * detail::bound_abs(result));
+        }
+
+        // record this node onto the calling thread's tape (the double lane replays
+        // as multiply-then-add; for float operands the product is exact in double)
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Deferred>>
+        std::uint32_t record() const {
+            const std::uint32_t a{ detail::id_of(m_a) };
+            const std::uint32_t b{ detail::id_of(m_b) };
+            const std::uint32_t addend{ detail::id_of(m_addend) };
+            const std::uint32_t product{ Deferred::tape().binary(Deferred::Op::Mul, a, b) };
+            return Deferred::tape().binary(Deferred::Op::Add, product, addend);
+        }
+
+        // evaluate the enclosure (multiply enclosure, then add enclosure; one
+        // representable step wider than the fused operation warrants, still valid)
+        template<Compare T = C, typename = std::enable_if_t<T == Compare::Interval>>
+        FP_REAL_DEVICE constexpr detail::lane_interval<TYPE> interval() const noexcept {
+            return detail::add_op::interval(detail::mul_op::interval(detail::interval_of<TYPE>(m_a), detail::interval_of<TYPE>(m_b)),
+                                            detail::interval_of<TYPE>(m_addend));
+        }
+    };
+
+    // --- unary numerical operator overload ---
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> operator - (const Real<P, C>& r) {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(-r.value(), -r.exact());
+        }
+        else if constexpr (C == Compare::Bound) {
+            return Real<P, C>(-r.value(), r.bound());   // negation is exact
+        }
+        else if constexpr (C == Compare::Deferred) {
+            return Real<P, C>(-r.value(), Deferred::tape().binary_literal(Deferred::Op::MulLiteral, r.id(), -1.0));
+        }
+        else if constexpr (C == Compare::Interval) {
+            return Real<P, C>(-r.value(), -r.hi(), -r.lo());    // negation is exact; the endpoints swap
+        }
+        else {
+            return Real<P, C>(-r.value());
+        }
+    }
+
+    template<typename E, typename = std::enable_if_t<detail::is_expression<E>::value>>
+    FP_REAL_DEVICE constexpr inline auto operator - (const E& xi_expression) {
+        return (static_cast<typename E::TYPE>(-1.0) * xi_expression);
+    }
+
+    // --- binary numerical operator overload (builds an expression node) ---
+#define M_NUMERICAL_OPERATOR(OP, TAG)                                                                                      \
+    template<typename LHS, typename RHS, typename = std::enable_if_t<detail::expression_valid<LHS, RHS>()>>                \
+    FP_REAL_DEVICE constexpr inline auto operator OP (const LHS& xi_lhs, const RHS& xi_rhs) {                                             \
+        return RealExpression<detail::pick_precision<LHS, RHS>(), detail::pick_compare<LHS, RHS>(),                        \
+                              detail::TAG, LHS, RHS>(xi_lhs, xi_rhs);                                                      \
+    }
+
+    M_NUMERICAL_OPERATOR(-, sub_op);
+    M_NUMERICAL_OPERATOR(*, mul_op);
+    M_NUMERICAL_OPERATOR(/, div_op);
+
+#undef M_NUMERICAL_OPERATOR
+
+    // operator + is written out (not stamped) so that, when FP_REAL_CONTRACT_FMA is
+    // defined, 'a * b + c' chains are contracted into a fused multiply-add node
+    template<typename LHS, typename RHS, typename = std::enable_if_t<detail::expression_valid<LHS, RHS>()>>
+    FP_REAL_DEVICE constexpr inline auto operator + (const LHS& xi_lhs, const RHS& xi_rhs) {
+        constexpr Precision P{ detail::pick_precision<LHS, RHS>() };
+        constexpr Compare   C{ detail::pick_compare<LHS, RHS>() };
+
+        if constexpr (detail::contract_fma && detail::is_mul_expression<LHS>::value) {
+            return RealFmaExpression<P, C, decltype(xi_lhs.m_lhs), decltype(xi_lhs.m_rhs), RHS>(xi_lhs.m_lhs, xi_lhs.m_rhs, xi_rhs);
+        }
+        else if constexpr (detail::contract_fma && detail::is_mul_expression<RHS>::value) {
+            return RealFmaExpression<P, C, decltype(xi_rhs.m_lhs), decltype(xi_rhs.m_rhs), LHS>(xi_rhs.m_lhs, xi_rhs.m_rhs, xi_lhs);
+        }
+        else {
+            return RealExpression<P, C, detail::add_op, LHS, RHS>(xi_lhs, xi_rhs);
+        }
+    }
+
+    // --- relational operator overload ---
+
+#define M_RELATIONAL_OPERATOR(OP)                                                                                                                  \
+    template<typename LHS, typename RHS, typename = std::enable_if_t<detail::expression_valid<LHS, RHS>()>>                                        \
+    FP_REAL_DEVICE constexpr inline bool operator OP (const LHS& xi_lhs, const RHS& xi_rhs) {                                                                     \
+        using TYPE = typename Real<detail::pick_precision<LHS, RHS>(), detail::pick_compare<LHS, RHS>()>::TYPE;                                    \
+        return (detail::value_of<TYPE>(xi_lhs) OP detail::value_of<TYPE>(xi_rhs));                                                                 \
+    }
+
+    M_RELATIONAL_OPERATOR(==);
+    M_RELATIONAL_OPERATOR(!=);
+    M_RELATIONAL_OPERATOR(>);
+    M_RELATIONAL_OPERATOR(>=);
+    M_RELATIONAL_OPERATOR(<);
+    M_RELATIONAL_OPERATOR(<=);
+
+#undef M_RELATIONAL_OPERATOR
+};
+
+#undef M_REAL_RECORD
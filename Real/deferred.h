@@ -0,0 +1,162 @@
+#pragma once
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<utility>
+#include<vector>
+
+/**
+* Real/deferred.h - the thread-local operation tape behind Compare::Deferred.
+*
+* In deferred mode a mutating operation does not compute its 'exact' double
+* inline (that dependency chain is what makes full comparison mode costly on a
+* latency critical path); instead it appends one compact record - opcode plus
+* operand record ids - to the calling thread's arena backed tape and stores the
+* new record's id in the variable. FP::replay() later walks the tape in order
+* and reconstructs every record's exact value, off the hot path (or on another
+* thread entirely, after Deferred::take()-ing the tape from the producer).
+*
+* The tape grows until cleared; clear it (or take it) at a request boundary.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+    namespace Deferred {
+
+        // opcode of one tape record
+        enum class Op : std::uint8_t {
+            Literal,        // exact = _literal (variable set from a scalar / non-tracked source)
+            Add,            // exact = exact[_lhs] + exact[_rhs]
+            Sub,            // exact = exact[_lhs] - exact[_rhs]
+            Mul,            // exact = exact[_lhs] * exact[_rhs]
+            Div,            // exact = exact[_lhs] / exact[_rhs]
+            AddLiteral,     // exact = exact[_lhs] + _literal
+            SubLiteral,     // exact = exact[_lhs] - _literal
+            MulLiteral,     // exact = exact[_lhs] * _literal
+            DivLiteral      // exact = exact[_lhs] / _literal
+        };
+
+        // one recorded operation; its id is its index on the tape
+        struct Record {
+            double _literal;        // scalar operand (literal opcodes only)
+            std::uint32_t _lhs;     // id of the left hand side operand's record
+            std::uint32_t _rhs;     // id of the right hand side operand's record
+            Op _op;                 // operation
+        };
+
+        /**
+        * \brief an append-only arena of operation records
+        **/
+        class Tape {
+            // properties
+            private:
+                std::vector<Record> m_records;      // the recorded operations, in program order
+
+            // constructor
+            public:
+                Tape() = default;
+
+                Tape(const Tape&)            = delete;
+                Tape& operator=(const Tape&) = delete;
+                Tape(Tape&&) noexcept            = default;
+                Tape& operator=(Tape&&) noexcept = default;
+
+            // modifiers
+            public:
+
+                // append a literal record, returning its id
+                std::uint32_t literal(const double xi_value) {
+                    m_records.push_back(Record{ xi_value, 0, 0, Op::Literal });
+                    return static_cast<std::uint32_t>(m_records.size() - 1);
+                }
+
+                // append a binary record over two existing records, returning its id
+                std::uint32_t binary(const Op xi_op, const std::uint32_t xi_lhs, const std::uint32_t xi_rhs) {
+                    m_records.push_back(Record{ 0.0, xi_lhs, xi_rhs, xi_op });
+                    return static_cast<std::uint32_t>(m_records.size() - 1);
+                }
+
+                // append a binary record over an existing record and a scalar, returning its id
+                std::uint32_t binary_literal(const Op xi_op, const std::uint32_t xi_lhs, const double xi_value) {
+                    m_records.push_back(Record{ xi_value, xi_lhs, 0, xi_op });
+                    return static_cast<std::uint32_t>(m_records.size() - 1);
+                }
+
+                // forget every record (existing deferred variables' ids become stale)
+                void clear() noexcept { m_records.clear(); }
+
+            // getters
+            public:
+
+                // amount of recorded operations
+                std::size_t size() const noexcept { return m_records.size(); }
+
+                // the recorded operations, in program order
+                std::span<const Record> records() const noexcept { return std::span<const Record>(m_records); }
+        };
+
+        // internal: the calling thread's tape storage. deliberately a lazily
+        // allocated pointer rather than a thread_local Tape: the tape must stay
+        // addressable while a background thread replays it, so it is never torn
+        // down at thread exit (its memory is reclaimed by take()/clear(), which
+        // every request boundary should call anyway)
+        namespace detail {
+            inline thread_local Tape* t_tape{ nullptr };
+        }
+
+        // the calling thread's tape
+        inline Tape& tape() {
+            if (detail::t_tape == nullptr) {
+                detail::t_tape = new Tape();
+            }
+            return *detail::t_tape;
+        }
+
+        // move the calling thread's tape out (e.g. - to replay it on a background
+        // thread), leaving a fresh empty tape behind
+        inline Tape take() {
+            Tape taken{ std::move(tape()) };
+            tape() = Tape();
+            return taken;
+        }
+
+        /**
+        * \brief reconstruct the exact value of every record of a tape, in order
+        *
+        * @param {Tape,   in}  tape to replay
+        * @param {vector, out} exact value per record id
+        **/
+        inline std::vector<double> replay(const Tape& xi_tape) {
+            const std::span<const Record> records{ xi_tape.records() };
+            std::vector<double> exacts(records.size());
+
+            for (std::size_t i{}; i < records.size(); ++i) {
+                const Record& record{ records[i] };
+                switch (record._op) {
+                    case Op::Literal:    exacts[i] = record._literal;                           break;
+                    case Op::Add:        exacts[i] = exacts[record._lhs] + exacts[record._rhs]; break;
+                    case Op::Sub:        exacts[i] = exacts[record._lhs] - exacts[record._rhs]; break;
+                    case Op::Mul:        exacts[i] = exacts[record._lhs] * exacts[record._rhs]; break;
+                    case Op::Div:        exacts[i] = exacts[record._lhs] / exacts[record._rhs]; break;
+                    case Op::AddLiteral: exacts[i] = exacts[record._lhs] + record._literal;     break;
+                    case Op::SubLiteral: exacts[i] = exacts[record._lhs] - record._literal;     break;
+                    case Op::MulLiteral: exacts[i] = exacts[record._lhs] * record._literal;     break;
+                    case Op::DivLiteral: exacts[i] = exacts[record._lhs] / record._literal;     break;
+                }
+            }
+
+            return exacts;
+        }
+    }
+
+    // replay the calling thread's tape
+    inline std::vector<double> replay() { return Deferred::replay(Deferred::tape()); }
+
+    // exact value / error of a deferred mode variable, given a replayed tape
+    template<typename REAL> double replayed_exact(const REAL& xi_real, const std::span<const double> xi_exacts) noexcept {
+        return xi_exacts[xi_real.id()];
+    }
+    template<typename REAL> double replayed_error(const REAL& xi_real, const std::span<const double> xi_exacts) noexcept {
+        return (xi_exacts[xi_real.id()] - static_cast<double>(xi_real.value()));
+    }
+};
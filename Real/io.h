@@ -0,0 +1,47 @@
+#pragma once
+#include"core.h"
+#include<iostream>
+
+#if defined(__cpp_lib_format)
+#include<format>
+#include<string_view>
+#endif
+
+/**
+* Real/io.h - textual output of Real: the ostream insertion operator and the
+* std::formatter specialization (both are thin wrappers over Real::to_chars,
+* which stays in Real/core.h since it only needs <charconv>). Split out of
+* Real.h so translation units which never print do not pay for <iostream>.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief write a Real into an output stream (through a stack buffer; no allocation)
+    *
+    * @param {ostream, in/out} output stream
+    * @param {Real,    in}     variable to be written
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    inline std::ostream& operator << (std::ostream& xio_stream, const Real<PRECISION, COMPARE>& xi_real) {
+        char buffer[192];
+        return xio_stream.write(buffer, xi_real.to_chars(buffer, buffer + sizeof(buffer)) - buffer);
+    }
+
+    // expressions are materialized before being written
+    template<typename EXPRESSION, typename = std::enable_if_t<detail::is_expression<EXPRESSION>::value>>
+    inline std::ostream& operator << (std::ostream& xio_stream, const EXPRESSION& xi_expression) {
+        return (xio_stream << detail::real_of_t<EXPRESSION>(xi_expression));
+    }
+};
+
+#if defined(__cpp_lib_format)
+// std::format support (same textual form as operator<<, allocation free)
+template<FP::Precision P, FP::Compare C> struct std::formatter<FP::Real<P, C>> : std::formatter<std::string_view> {
+    template<typename CONTEXT> auto format(const FP::Real<P, C>& real, CONTEXT& xio_context) const {
+        char buffer[192];
+        return std::formatter<std::string_view>::format(std::string_view(buffer, real.to_chars(buffer, buffer + sizeof(buffer)) - buffer), xio_context);
+    }
+};
+#endif
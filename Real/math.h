@@ -0,0 +1,561 @@
+#pragma once
+#include"core.h"
+
+/**
+* Real/math.h - the libm wrapper families of Real: the unary functions (abs ... lgamma),
+* the binary functions (pow, hypot, atan2, remainder, fmod), fma, and the non standard
+* numeric operations (sign, min, max, clamp). Split out of Real.h so translation units
+* which only do arithmetic do not pay for ~30 function template instantiation sites.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // compile-time capable math kernels. libm is not constexpr before C++26, so a
+    // Real constant built from a transcendental is computed at startup of every
+    // process instead of folding into .rodata; each cx_* wrapper below dispatches
+    // to libm at runtime and, during constant evaluation, to a constexpr kernel
+    // (Newton for sqrt, argument-reduced series for exp/log/sin/cos). the kernels
+    // are within a few ULP of libm - the runtime path stays bit identical
+    namespace detail {
+        namespace ce {
+
+            inline constexpr double two_pi{ 6.283185307179586476925286766559 };
+            inline constexpr double ln2{ 0.69314718055994530941723212145818 };
+
+            FP_REAL_DEVICE constexpr double abs(const double x) noexcept { return ((x < 0.0) ? -x : x); }
+
+            FP_REAL_DEVICE constexpr double trunc(const double x) noexcept {
+                if (!(abs(x) < 9223372036854775808.0)) {    // already integral (or NaN/inf)
+                    return x;
+                }
+                return static_cast<double>(static_cast<long long>(x));
+            }
+
+            FP_REAL_DEVICE constexpr double floor(const double x) noexcept {
+                const double t{ trunc(x) };
+                return (((x < 0.0) && (x != t)) ? (t - 1.0) : t);
+            }
+
+            FP_REAL_DEVICE constexpr double ceil(const double x) noexcept {
+                const double t{ trunc(x) };
+                return (((x > 0.0) && (x != t)) ? (t + 1.0) : t);
+            }
+
+            FP_REAL_DEVICE constexpr double round(const double x) noexcept {
+                return ((x != x) ? x : trunc((x < 0.0) ? (x - 0.5) : (x + 0.5)));
+            }
+
+            FP_REAL_DEVICE constexpr double sqrt(const double x) noexcept {
+                if (x < 0.0) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                if ((x == 0.0) || (x != x) || (x == std::numeric_limits<double>::infinity())) {
+                    return x;
+                }
+                double y{ x };
+                double prev{ 0.0 };
+                for (std::size_t i{}; (i < 200) && (y != prev); ++i) {  // Babylonian; monotone after the first step
+                    prev = y;
+                    y = 0.5 * (y + x / y);
+                }
+                return y;
+            }
+
+            FP_REAL_DEVICE constexpr double exp(const double x) noexcept {
+                if (x != x) {
+                    return x;
+                }
+                if (x > 709.8) {
+                    return std::numeric_limits<double>::infinity();
+                }
+                if (x < -745.2) {
+                    return 0.0;
+                }
+                const double k{ round(x / ln2) };
+                const double r{ x - k * ln2 };
+                double term{ 1.0 };
+                double sum{ 1.0 };
+                for (int i{ 1 }; i < 30; ++i) {     // |r| <= ln2/2; 30 terms over-converge
+                    term *= r / static_cast<double>(i);
+                    sum += term;
+                }
+                const double base{ (k >= 0.0) ? 2.0 : 0.5 };
+                double scale{ 1.0 };
+                for (int i{}; i < static_cast<int>(abs(k)); ++i) {
+                    scale *= base;
+                }
+                return (sum * scale);
+            }
+
+            FP_REAL_DEVICE constexpr double log(const double x) noexcept {
+                if ((x != x) || (x == std::numeric_limits<double>::infinity())) {
+                    return x;
+                }
+                if (x < 0.0) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                if (x == 0.0) {
+                    return -std::numeric_limits<double>::infinity();
+                }
+                double m{ x };
+                int e{};
+                while (m >= 2.0) { m *= 0.5; ++e; }
+                while (m < 1.0)  { m *= 2.0; --e; }
+                const double z{ (m - 1.0) / (m + 1.0) };    // log(m) = 2 atanh(z)
+                const double zz{ z * z };
+                double term{ z };
+                double sum{ 0.0 };
+                for (int n{ 1 }; n < 60; n += 2) {
+                    sum += term / static_cast<double>(n);
+                    term *= zz;
+                }
+                return (2.0 * sum + static_cast<double>(e) * ln2);
+            }
+
+            FP_REAL_DEVICE constexpr double sin(const double x) noexcept {
+                if ((x != x) || (abs(x) == std::numeric_limits<double>::infinity())) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                const double r{ x - two_pi * round(x / two_pi) };   // one step reduction to [-pi, pi]
+                double term{ r };
+                double sum{ r };
+                for (int i{ 1 }; i < 25; ++i) {
+                    term *= -(r * r) / static_cast<double>((2 * i) * (2 * i + 1));
+                    sum += term;
+                }
+                return sum;
+            }
+
+            FP_REAL_DEVICE constexpr double cos(const double x) noexcept {
+                if ((x != x) || (abs(x) == std::numeric_limits<double>::infinity())) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                const double r{ x - two_pi * round(x / two_pi) };
+                double term{ 1.0 };
+                double sum{ 1.0 };
+                for (int i{ 1 }; i < 25; ++i) {
+                    term *= -(r * r) / static_cast<double>((2 * i - 1) * (2 * i));
+                    sum += term;
+                }
+                return sum;
+            }
+        }
+
+        // the dispatching wrappers the M_UNARY_FUNCTION stamps below take in place
+        // of the plain libm entry points
+#define M_CE_DISPATCH(NAME)                                                                   \
+        template<typename T> FP_REAL_DEVICE constexpr T cx_##NAME(const T x) noexcept {                      \
+            if (std::is_constant_evaluated()) {                                               \
+                return static_cast<T>(ce::NAME(static_cast<double>(x)));                      \
+            }                                                                                 \
+            return std::NAME(x);                                                              \
+        }
+        M_CE_DISPATCH(abs);
+        M_CE_DISPATCH(floor);
+        M_CE_DISPATCH(ceil);
+        M_CE_DISPATCH(round);
+        M_CE_DISPATCH(trunc);
+        M_CE_DISPATCH(sqrt);
+        M_CE_DISPATCH(exp);
+        M_CE_DISPATCH(log);
+        M_CE_DISPATCH(sin);
+        M_CE_DISPATCH(cos);
+#undef M_CE_DISPATCH
+    }
+
+    // --- standard unary numerical functions ---
+#define M_UNARY_FUNCTION(NAME, OPERATION)                                                                             \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const Real<P, C>& r) noexcept {                 \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                            \
+            return Real<P, C>(OPERATION(detail::math_arg(r.value())), OPERATION(r.exact()));                                            \
+        }                                                                                                             \
+        else {                                                                                                        \
+            return Real<P, C>(OPERATION(detail::math_arg(r.value())));                                                                  \
+        }                                                                                                             \
+    }                                                                                                                 \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const typename Real<P, C>::TYPE r) noexcept {   \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                            \
+            return Real<P, C>(OPERATION(detail::math_arg(r)), OPERATION(static_cast<double>(r)));                                       \
+        }                                                                                                             \
+        else {                                                                                                        \
+            return Real<P, C>(OPERATION(detail::math_arg(r)));                                                                          \
+        }                                                                                                             \
+    }                                                                                                                 \
+    template<typename E, typename = std::enable_if_t<detail::is_expression<E>::value>>                                \
+    FP_REAL_DEVICE constexpr inline auto NAME(const E& xi_expression) noexcept {                                                     \
+        return NAME(detail::real_of_t<E>(xi_expression));                                                             \
+    }
+    M_UNARY_FUNCTION(abs, detail::cx_abs);
+    M_UNARY_FUNCTION(floor, detail::cx_floor);
+    M_UNARY_FUNCTION(ceil, detail::cx_ceil);
+    M_UNARY_FUNCTION(round, detail::cx_round);
+    M_UNARY_FUNCTION(rint, std::rint);
+    M_UNARY_FUNCTION(trunc, detail::cx_trunc);
+    M_UNARY_FUNCTION(sqrt, detail::cx_sqrt);
+    M_UNARY_FUNCTION(cbrt, std::cbrt);
+    M_UNARY_FUNCTION(exp, detail::cx_exp);
+    M_UNARY_FUNCTION(exp2, std::exp2);
+    M_UNARY_FUNCTION(log, detail::cx_log);
+    M_UNARY_FUNCTION(log2, std::log2);
+    M_UNARY_FUNCTION(log10, std::log10);
+    M_UNARY_FUNCTION(log1p, std::log1p);
+    M_UNARY_FUNCTION(sin, detail::cx_sin);
+    M_UNARY_FUNCTION(cos, detail::cx_cos);
+    M_UNARY_FUNCTION(tan, std::tan);
+    M_UNARY_FUNCTION(asin, std::asin);
+    M_UNARY_FUNCTION(acos, std::acos);
+    M_UNARY_FUNCTION(atan, std::atan);
+    M_UNARY_FUNCTION(sinh, std::sinh);
+    M_UNARY_FUNCTION(cosh, std::cosh);
+    M_UNARY_FUNCTION(tanh, std::tanh);
+    M_UNARY_FUNCTION(asinh, std::asinh);
+    M_UNARY_FUNCTION(acosh, std::acosh);
+    M_UNARY_FUNCTION(atanh, std::atanh);
+    M_UNARY_FUNCTION(erf, std::erf);
+    M_UNARY_FUNCTION(erfc, std::erfc);
+    M_UNARY_FUNCTION(tgamma, std::tgamma);
+    M_UNARY_FUNCTION(lgamma, std::lgamma);
+
+#undef M_UNARY_FUNCTION
+
+    // internal: sine and cosine of one lane in a single call, sharing the argument
+    // reduction between both results where libm provides a fused entry point
+    namespace detail {
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+        inline void sincos_lane(const double x, double& s, double& c) noexcept { ::sincos(x, &s, &c);   }
+        inline void sincos_lane(const float x,  float& s,  float& c)  noexcept { ::sincosf(x, &s, &c); }
+#else
+        inline void sincos_lane(const double x, double& s, double& c) noexcept { s = std::sin(x); c = std::cos(x); }
+        inline void sincos_lane(const float x,  float& s,  float& c)  noexcept { s = std::sin(x); c = std::cos(x); }
+#endif
+    }
+
+    /**
+    * \brief sine and cosine of the same argument in one call. the costly part of
+    *        both functions is the shared argument reduction - computing the pair
+    *        fused does it once per lane instead of once per result (twice per
+    *        result in comparison mode).
+    *
+    * @param {Real, in}  angle [rad]
+    * @param {Real, out} sine of angle
+    * @param {Real, out} cosine of angle
+    **/
+    template<Precision P, Compare C> inline void sincos(const Real<P, C>& r, Real<P, C>& xo_sin, Real<P, C>& xo_cos) noexcept {
+        using TYPE = typename Real<P, C>::TYPE;
+        auto value_sin{ detail::math_arg(r.value()) };
+        auto value_cos{ value_sin };
+        detail::sincos_lane(detail::math_arg(r.value()), value_sin, value_cos);
+
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            double exact_sin{};
+            double exact_cos{};
+            detail::sincos_lane(r.exact(), exact_sin, exact_cos);
+            xo_sin = Real<P, C>(static_cast<TYPE>(value_sin), exact_sin);
+            xo_cos = Real<P, C>(static_cast<TYPE>(value_cos), exact_cos);
+        }
+        else {
+            xo_sin = Real<P, C>(static_cast<TYPE>(value_sin));
+            xo_cos = Real<P, C>(static_cast<TYPE>(value_cos));
+        }
+    }
+
+    template<typename E, typename = std::enable_if_t<detail::is_expression<E>::value>>
+    inline void sincos(const E& xi_expression, detail::real_of_t<E>& xo_sin, detail::real_of_t<E>& xo_cos) noexcept {
+        sincos(detail::real_of_t<E>(xi_expression), xo_sin, xo_cos);
+    }
+
+    // --- binary Real-TYPE numerical functions ---
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> pow(const Real<P, C>& r, const typename Real<P, C>::TYPE p) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::pow(detail::math_arg(r.value()), detail::math_arg(p)), std::pow(r.exact(), static_cast<double>(p)));
+        }
+        else {
+            return Real<P, C>(std::pow(detail::math_arg(r.value()), detail::math_arg(p)));
+        }
+    }
+
+    template<typename E, typename = std::enable_if_t<detail::is_expression<E>::value>>
+    FP_REAL_DEVICE constexpr inline auto pow(const E& xi_expression, const typename E::TYPE p) noexcept {
+        return pow(detail::real_of_t<E>(xi_expression), p);
+    }
+
+    /**
+    * \brief fused multiply-add: a * b + c in one rounded operation, on both the
+    *        'used' lane and (in comparison mode) the 'exact' lane. on FMA hardware
+    *        this is one instruction, and the tracked value itself is more accurate
+    *        than a separate multiply and add.
+    *
+    * @param {Real/TYPE, in}  first multiplicand
+    * @param {Real/TYPE, in}  second multiplicand
+    * @param {Real/TYPE, in}  addend
+    * @param {Real,      out} a * b + c
+    **/
+    template<Precision P, Compare C> FP_REAL_DEVICE inline Real<P, C> fma(const Real<P, C>& a, const Real<P, C>& b, const Real<P, C>& c) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fma(detail::math_arg(a.value()), detail::math_arg(b.value()), detail::math_arg(c.value())), std::fma(a.exact(), b.exact(), c.exact()));
+        }
+        else if constexpr (C == Compare::Bound) {
+            using TYPE = typename Real<P, C>::TYPE;
+            const TYPE result{ static_cast<TYPE>(std::fma(detail::math_arg(a.value()), detail::math_arg(b.value()), detail::math_arg(c.value()))) };
+            return Real<P, C>(result, detail::bound_abs(a.value()) * b.bound() +
+                                      detail::bound_abs(b.value()) * a.bound() +
+                                      c.bound() +
+                                      detail::half_ulp<TYPE>() * detail::bound_abs(result));
+        }
+        else if constexpr (C == Compare::Deferred) {
+            using TYPE = typename Real<P, C>::TYPE;
+            const TYPE result{ static_cast<TYPE>(std::fma(detail::math_arg(a.value()), detail::math_arg(b.value()), detail::math_arg(c.value()))) };
+            // the double lane replays as multiply-then-add (exact product for float operands)
+            const std::uint32_t product{ Deferred::tape().binary(Deferred::Op::Mul, a.id(), b.id()) };
+            return Real<P, C>(result, Deferred::tape().binary(Deferred::Op::Add, product, c.id()));
+        }
+        else if constexpr (C == Compare::Interval) {
+            using TYPE = typename Real<P, C>::TYPE;
+            const TYPE result{ static_cast<TYPE>(std::fma(detail::math_arg(a.value()), detail::math_arg(b.value()), detail::math_arg(c.value()))) };
+            const detail::lane_interval<TYPE> enclosure{ detail::add_op::interval(detail::mul_op::interval(a.interval(), b.interval()), c.interval()) };
+            return Real<P, C>(result, enclosure._lo, enclosure._hi);
+        }
+        else {
+            return Real<P, C>(std::fma(detail::math_arg(a.value()), detail::math_arg(b.value()), detail::math_arg(c.value())));
+        }
+    }
+
+    template<typename A, typename B, typename ADDEND,
+             typename = std::enable_if_t<detail::ternary_valid<A, B, ADDEND>() &&
+                                         (!(detail::is_real_leaf<A>::value && detail::is_real_leaf<B>::value && detail::is_real_leaf<ADDEND>::value) ||
+                                          detail::mixed_real_leaves<A, B>() || detail::mixed_real_leaves<A, ADDEND>() || detail::mixed_real_leaves<B, ADDEND>())>>
+    FP_REAL_DEVICE inline auto fma(const A& a, const B& b, const ADDEND& c) noexcept {
+        using REAL = Real<detail::pick_precision3<A, B, ADDEND>(), detail::pick_compare3<A, B, ADDEND>()>;
+        return fma(REAL(detail::as_operand<REAL>(a)), REAL(detail::as_operand<REAL>(b)), REAL(detail::as_operand<REAL>(c)));
+    }
+
+    // --- standard binary Real-Real & Real-TYPE numerical functions ---
+#define M_BINARY_FUNCTION(NAME, OPERATION)                                                                                                              \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const Real<P, C>& l, const Real<P, C>& r) noexcept {                              \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                                                              \
+            return Real<P, C>(OPERATION(detail::math_arg(l.value()), detail::math_arg(r.value())), OPERATION(l.exact(), r.exact()));                                                        \
+        }                                                                                                                                               \
+        else {                                                                                                                                          \
+            return Real<P, C>(OPERATION(detail::math_arg(l.value()), detail::math_arg(r.value())));                                                                                         \
+        }                                                                                                                                               \
+    }                                                                                                                                                   \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const Real<P, C>& l, const typename Real<P, C>::TYPE p) noexcept {                \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                                                              \
+            return Real<P, C>(OPERATION(detail::math_arg(l.value()), detail::math_arg(p)), OPERATION(l.exact(), static_cast<double>(p)));                                                   \
+        }                                                                                                                                               \
+        else {                                                                                                                                          \
+            return Real<P, C>(OPERATION(detail::math_arg(l.value()), detail::math_arg(p)));                                                                                                 \
+        }                                                                                                                                               \
+    }                                                                                                                                                   \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const typename Real<P, C>::TYPE p, const Real<P, C>& r) noexcept {                \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                                                              \
+            return Real<P, C>(OPERATION(detail::math_arg(p), detail::math_arg(r.value())), OPERATION(static_cast<double>(p), r.exact()));                                                   \
+        }                                                                                                                                               \
+        else {                                                                                                                                          \
+            return Real<P, C>(OPERATION(detail::math_arg(p), detail::math_arg(r.value())));                                                                                                 \
+        }                                                                                                                                               \
+    }                                                                                                                                                   \
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> NAME(const typename Real<P, C>::TYPE p, const typename Real<P, C>::TYPE r) noexcept {  \
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {                                                                                                              \
+            return Real<P, C>(OPERATION(detail::math_arg(p), detail::math_arg(r)), OPERATION(static_cast<double>(p), static_cast<double>(r)));                                              \
+        }                                                                                                                                               \
+        else {                                                                                                                                          \
+            return Real<P, C>(OPERATION(detail::math_arg(p), detail::math_arg(r)));                                                                                                         \
+        }                                                                                                                                               \
+    }                                                                                                                                                   \
+    template<typename LHS, typename RHS,                                                                                                                \
+             typename = std::enable_if_t<(detail::is_expression<std::decay_t<LHS>>::value || detail::is_expression<std::decay_t<RHS>>::value ||         \
+                                          detail::mixed_real_leaves<LHS, RHS>()) &&                                                                     \
+                                         detail::expression_valid<LHS, RHS>()>>                                                                         \
+    FP_REAL_DEVICE constexpr inline auto NAME(const LHS& l, const RHS& r) noexcept {                                                                                   \
+        using REAL = Real<detail::pick_precision<LHS, RHS>(), detail::pick_compare<LHS, RHS>()>;                                                        \
+        return NAME(detail::as_operand<REAL>(l), detail::as_operand<REAL>(r));                                                                          \
+    }
+
+    M_BINARY_FUNCTION(hypot, std::hypot);
+    M_BINARY_FUNCTION(atan2, std::atan2);
+    M_BINARY_FUNCTION(remainder, std::remainder);
+    M_BINARY_FUNCTION(fmod, std::fmod);
+
+#undef M_BINARY_FUNCTION
+
+    // --- non standard numeric operations ---
+
+    // return the sign of a Real
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> sign(const Real<P, C>& r) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            typename Real<P, C>::TYPE v{ r.value() < static_cast<typename Real<P, C>::TYPE>(0.0) ? 
+                                         static_cast<typename Real<P, C>::TYPE>(-1.0) : 
+                                         static_cast<typename Real<P, C>::TYPE>(1.0) };
+            return Real<P, C>(v, static_cast<double>(v));
+        }
+        else {
+            return Real<P, C>(r.value() < static_cast<typename Real<P, C>::TYPE>(0.0) ? 
+                              static_cast<typename Real<P, C>::TYPE>(-1.0) : 
+                              static_cast<typename Real<P, C>::TYPE>(1.0));
+        }
+    }
+    template<typename E, typename = std::enable_if_t<detail::is_expression<E>::value>>
+    FP_REAL_DEVICE constexpr inline auto sign(const E& xi_expression) noexcept {
+        return sign(detail::real_of_t<E>(xi_expression));
+    }
+
+    /**
+    * \brief return the minimal value amongst all input argument
+    * 
+    * @param {Real/TYPE, in}  a pack of Real or TYPE values
+    * @param {Real/TYPE, in}  ....
+    * @param {Real,      out} minimal value among all values in the pack
+    **/
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> min(const Real<P, C>& r) noexcept {
+        return r;
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> min(const typename Real<P, C>::TYPE p) noexcept {
+        return Real<P, C>(p);
+    }
+
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> min(const Real<P, C>& l, const Real<P, C>& r) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmin(detail::math_arg(l.value()), detail::math_arg(r.value())), std::fmin(l.exact(), r.exact()));
+        }
+        else {
+            return Real<P, C>(std::fmin(detail::math_arg(l.value()), detail::math_arg(r.value())));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> min(const typename Real<P, C>::TYPE p, const Real<P, C>& r) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmin(detail::math_arg(p), detail::math_arg(r.value())), std::fmin(static_cast<double>(p), r.exact()));
+        }
+        else {
+            return Real<P, C>(std::fmin(detail::math_arg(p), detail::math_arg(r.value())));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> min(const Real<P, C>& l, const typename Real<P, C>::TYPE p) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmin(detail::math_arg(l.value()), detail::math_arg(p)), std::fmin(l.exact(), static_cast<double>(p)));
+        }
+        else {
+            return Real<P, C>(std::fmin(detail::math_arg(l.value()), detail::math_arg(p)));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline typename Real<P, C>::TYPE min(const typename Real<P, C>::TYPE l, const typename Real<P, C>::TYPE p) noexcept {
+        return std::fmin(detail::math_arg(l), detail::math_arg(p));
+    }
+
+
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> min(const Real<P, C>& l, const Real<P, C>& r, const TS... args) noexcept {
+        return min(min(l, r), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> min(const typename Real<P, C>::TYPE p, const Real<P, C>& r, const TS... args) noexcept {
+        return min(min(p, r), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> min(const Real<P, C>& l, const typename Real<P, C>::TYPE p, const TS... args) noexcept {
+        return min(min(l, p), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline typename Real<P, C>::TYPE min(const typename Real<P, C>::TYPE l, const typename Real<P, C>::TYPE p, const TS... args) noexcept {
+        return min(min(l, p), args...);
+    }
+
+    template<typename LHS, typename RHS, typename... TS,
+             typename = std::enable_if_t<(detail::is_expression<std::decay_t<LHS>>::value || detail::is_expression<std::decay_t<RHS>>::value ||
+                                          detail::mixed_real_leaves<LHS, RHS>()) &&
+                                         detail::expression_valid<LHS, RHS>()>>
+    FP_REAL_DEVICE constexpr inline auto min(const LHS& l, const RHS& r, const TS... args) noexcept {
+        using REAL = Real<detail::pick_precision<LHS, RHS>(), detail::pick_compare<LHS, RHS>()>;
+        return min(min(detail::as_operand<REAL>(l), detail::as_operand<REAL>(r)), args...);
+    }
+
+    /**
+    * \brief return the maximal value amongst all input argument
+    * 
+    * @param {Real/TYPE, in}  a pack of Real or TYPE values
+    * @param {Real/TYPE, in}  ....
+    * @param {Real,      out} maximal value among all values in the pack
+    **/
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> max(const Real<P, C>& r) noexcept {
+        return r;
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> max(const typename Real<P, C>::TYPE p) noexcept {
+        return Real<P, C>(p);
+    }
+
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> max(const Real<P, C>& l, const Real<P, C>& r) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmax(detail::math_arg(l.value()), detail::math_arg(r.value())), std::fmin(l.exact(), r.exact()));
+        }
+        else {
+            return Real<P, C>(std::fmax(detail::math_arg(l.value()), detail::math_arg(r.value())));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> max(const typename Real<P, C>::TYPE p, const Real<P, C>& r) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmax(detail::math_arg(p), detail::math_arg(r.value())), std::fmax(static_cast<double>(p), r.exact()));
+        }
+        else {
+            return Real<P, C>(std::fmax(detail::math_arg(p), detail::math_arg(r.value())));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> max(const Real<P, C>& l, const typename Real<P, C>::TYPE p) noexcept {
+        if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+            return Real<P, C>(std::fmax(detail::math_arg(l.value()), detail::math_arg(p)), std::fmax(l.exact(), static_cast<double>(p)));
+        }
+        else {
+            return Real<P, C>(std::fmax(detail::math_arg(l.value()), detail::math_arg(p)));
+        }
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline typename Real<P, C>::TYPE max(const typename Real<P, C>::TYP& l, const typename Real<P, C>::TYPE p) noexcept {
+        return std::fmax(detail::math_arg(l), detail::math_arg(p));
+    }
+
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> max(const Real<P, C>& l, const Real<P, C>& r, const TS... args) noexcept {
+        return max(max(l, r), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> max(const typename Real<P, C>::TYPE p, const Real<P, C>& r, const TS... args) noexcept {
+        return max(max(p, r), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline Real<P, C> max(const Real<P, C>& l, const typename Real<P, C>::TYPE p, const TS... args) noexcept {
+        return max(max(l, p), args...);
+    }
+    template<Precision P, Compare C, typename... TS> FP_REAL_DEVICE constexpr inline typename Real<P, C>::TYPE max(const typename Real<P, C>::TYPE l, const typename Real<P, C>::TYPE p, const TS... args) noexcept {
+        return max(max(l, p), args...);
+    }
+
+    template<typename LHS, typename RHS, typename... TS,
+             typename = std::enable_if_t<(detail::is_expression<std::decay_t<LHS>>::value || detail::is_expression<std::decay_t<RHS>>::value ||
+                                          detail::mixed_real_leaves<LHS, RHS>()) &&
+                                         detail::expression_valid<LHS, RHS>()>>
+    FP_REAL_DEVICE constexpr inline auto max(const LHS& l, const RHS& r, const TS... args) noexcept {
+        using REAL = Real<detail::pick_precision<LHS, RHS>(), detail::pick_compare<LHS, RHS>()>;
+        return max(max(detail::as_operand<REAL>(l), detail::as_operand<REAL>(r)), args...);
+    }
+    
+    /**
+    * \brief return the input argument clamped into a given region
+    * 
+    * @param {Real/TYPE, in}  value to be clamped
+    * @param {Real/TYPE, in}  clamping region lower value
+    * @param {Real/TYPE, in}  clamping region upper value
+    * @param {Real,      out} clamped value
+    **/
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> clamp(const Real<P, C>& r, const typename Real<P, C>::TYPE lo, const typename Real<P, C>::TYPE hi) noexcept {
+        return min(lo, max(r, hi));
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> clamp(const Real<P, C>& r, const Real<P, C>& lo, const typename Real<P, C>::TYPE hi) noexcept {
+        return min(lo, max(r, hi));
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> clamp(const Real<P, C>& r, const typename Real<P, C>::TYPE lo, const Real<P, C>& hi) noexcept {
+        return min(lo, max(r, hi));
+    }
+    template<Precision P, Compare C> FP_REAL_DEVICE constexpr inline Real<P, C> clamp(const Real<P, C>& r, const Real<P, C>& lo, const Real<P, C>& hi) noexcept {
+        return min(lo, max(r, hi));
+    }
+    template<typename R, typename LO, typename HI,
+             typename = std::enable_if_t<detail::ternary_valid<R, LO, HI>() &&
+                                         (!(detail::is_real_leaf<R>::value && detail::is_real_leaf<LO>::value && detail::is_real_leaf<HI>::value) ||
+                                          detail::mixed_real_leaves<R, LO>() || detail::mixed_real_leaves<R, HI>() || detail::mixed_real_leaves<LO, HI>())>>
+    FP_REAL_DEVICE constexpr inline auto clamp(const R& r, const LO& lo, const HI& hi) noexcept {
+        using REAL = Real<detail::pick_precision3<R, LO, HI>(), detail::pick_compare3<R, LO, HI>()>;
+        return clamp(REAL(detail::as_operand<REAL>(r)), detail::as_operand<REAL>(lo), detail::as_operand<REAL>(hi));
+    }
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include"core.h"
+#include<bit>
+#include<cstddef>
+#include<functional>
+
+/**
+* Real/traits.h - the trait surface that lets Real drop into generic code and
+* containers without a .value() round trip at every boundary:
+*
+* > FP::is_real / FP::is_real_v        - is a type some Real<P, C>?
+* > std::numeric_limits<Real<P, C>>    - forwards to the 'used' lane type
+* > std::hash<Real<P, C>>              - hash over the 'used' lane's value bits
+*                                        (operator== compares only the 'used' lanes,
+*                                         so equal keys hash equal in every mode)
+* > std::common_type                   - mixed precision pairs resolve to the wider
+*                                        precision, Real/scalar pairs to the Real
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // is T a Real (of any precision / comparison mode)?
+    template<typename T>             struct is_real             : std::false_type {};
+    template<Precision P, Compare C> struct is_real<Real<P, C>> : std::true_type  {};
+    template<typename T> inline constexpr bool is_real_v{ is_real<T>::value };
+
+};
+
+// numeric limits of a Real are those of its 'used' lane
+template<FP::Precision P, FP::Compare C> struct std::numeric_limits<FP::Real<P, C>> {
+    private:
+        using REAL = FP::Real<P, C>;
+        using BASE = std::numeric_limits<typename REAL::TYPE>;
+
+    public:
+        static constexpr bool is_specialized{ true };
+        static constexpr bool is_signed{ BASE::is_signed };
+        static constexpr bool is_integer{ BASE::is_integer };
+        static constexpr bool is_exact{ BASE::is_exact };
+        static constexpr bool has_infinity{ BASE::has_infinity };
+        static constexpr bool has_quiet_NaN{ BASE::has_quiet_NaN };
+        static constexpr bool has_signaling_NaN{ BASE::has_signaling_NaN };
+        static constexpr bool is_iec559{ BASE::is_iec559 };
+        static constexpr bool is_bounded{ BASE::is_bounded };
+        static constexpr bool is_modulo{ BASE::is_modulo };
+        static constexpr int digits{ BASE::digits };
+        static constexpr int digits10{ BASE::digits10 };
+        static constexpr int max_digits10{ BASE::max_digits10 };
+        static constexpr int radix{ BASE::radix };
+        static constexpr int min_exponent{ BASE::min_exponent };
+        static constexpr int min_exponent10{ BASE::min_exponent10 };
+        static constexpr int max_exponent{ BASE::max_exponent };
+        static constexpr int max_exponent10{ BASE::max_exponent10 };
+        static constexpr bool traps{ BASE::traps };
+        static constexpr bool tinyness_before{ BASE::tinyness_before };
+        static constexpr std::float_round_style round_style{ BASE::round_style };
+
+        static constexpr REAL min()           noexcept { return REAL(BASE::min());           }
+        static constexpr REAL lowest()        noexcept { return REAL(BASE::lowest());        }
+        static constexpr REAL max()           noexcept { return REAL(BASE::max());           }
+        static constexpr REAL epsilon()       noexcept { return REAL(BASE::epsilon());       }
+        static constexpr REAL round_error()   noexcept { return REAL(BASE::round_error());   }
+        static constexpr REAL infinity()      noexcept { return REAL(BASE::infinity());      }
+        static constexpr REAL quiet_NaN()     noexcept { return REAL(BASE::quiet_NaN());     }
+        static constexpr REAL signaling_NaN() noexcept { return REAL(BASE::signaling_NaN()); }
+        static constexpr REAL denorm_min()    noexcept { return REAL(BASE::denorm_min());    }
+};
+
+// hash over the 'used' lane's value bits (the lanes operator== compares; keys that
+// compare equal hash equal, regardless of their 'exact'/bound lanes). -0.0 is folded
+// onto +0.0 before hashing - the two compare equal but differ in their sign bit
+// (NaN needs no such folding: NaN != NaN, so NaN keys are never "equal")
+template<FP::Precision P, FP::Compare C> struct std::hash<FP::Real<P, C>> {
+    std::size_t operator()(const FP::Real<P, C>& xi_real) const noexcept {
+        using TYPE = typename FP::Real<P, C>::TYPE;
+        using BITS = FP::detail::lane_bits_t<TYPE>;
+        const TYPE canonical{ (xi_real.value() == TYPE(0)) ? TYPE(0) : xi_real.value() };
+        return std::hash<BITS>{}(std::bit_cast<BITS>(canonical));
+    }
+};
+
+// mixed precision pairs resolve to the wider precision; Real/scalar pairs to the Real
+template<FP::Precision P1, FP::Precision P2, FP::Compare C> struct std::common_type<FP::Real<P1, C>, FP::Real<P2, C>> {
+    using type = FP::Real<FP::detail::wider_precision<P1, P2>(), C>;
+};
+template<FP::Precision P, FP::Compare C, typename T> requires std::is_arithmetic_v<T> struct std::common_type<FP::Real<P, C>, T> {
+    using type = FP::Real<P, C>;
+};
+template<FP::Precision P, FP::Compare C, typename T> requires std::is_arithmetic_v<T> struct std::common_type<T, FP::Real<P, C>> {
+    using type = FP::Real<P, C>;
+};
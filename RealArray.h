@@ -0,0 +1,274 @@
+#pragma once
+#include"Real/core.h"
+#include<cstddef>
+#include<span>
+#include<vector>
+
+/**
+* RealArray is a structure-of-arrays container for Real variables.
+*
+* An array of Real<..., Compare::Yes> interleaves the 'used' value and its 'exact'
+* shadow per element, so a scan over only the used values drags the shadow plane
+* through the cache as well, and stops the compiler from vectorizing the scan.
+* RealArray stores the 'used' plane and the 'exact' plane in two separate contiguous
+* buffers, while element access still looks and behaves like a Real (via a proxy
+* reference), so existing element-wise code does not change.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // forward declaration (the element proxy references its owning array)
+    template<Precision, Compare> class RealArray;
+
+    /**
+    * \brief a Real-compatible proxy reference to one element of a RealArray (reads
+    *        and writes go through to the underlying planes). A namespace scope
+    *        template - not a nested class - so the operand_traits specialization
+    *        below can deduce it, and argument dependent lookup finds the operator
+    *        templates of namespace FP (a nested class would associate neither)
+    **/
+    template<Precision PRECISION, Compare COMPARE> class RealArrayReference {
+        // aliases
+        private:
+            using ARRAY = RealArray<PRECISION, COMPARE>;
+            using REAL  = Real<PRECISION, COMPARE>;
+            using TYPE  = typename REAL::TYPE;
+
+        // properties
+        private:
+            ARRAY* m_array;         // referenced array
+            std::size_t m_index;    // referenced element
+
+        // constructor (only RealArray creates references)
+        private:
+            friend ARRAY;
+            constexpr RealArrayReference(ARRAY* xi_array, const std::size_t xi_index) noexcept : m_array(xi_array), m_index(xi_index) {}
+
+        public:
+
+            // getters (mirror Real)
+            constexpr TYPE value() const noexcept { return m_array->m_planes._value[m_index]; }
+
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            constexpr double exact() const noexcept { return m_array->m_planes._exact[m_index]; }
+
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            constexpr double error() const noexcept { return (exact() - static_cast<double>(value())); }
+
+            // materialize a Real out of the referenced element
+            constexpr operator REAL() const noexcept {
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(value(), exact());
+                }
+                else {
+                    return REAL(value());
+                }
+            }
+
+            // assignment
+            constexpr RealArrayReference& operator=(const REAL& xi_value) {
+                m_array->m_planes._value[m_index] = xi_value.value();
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_array->m_planes._exact[m_index] = xi_value.exact();
+                }
+
+                return *this;
+            }
+
+            template<typename U, typename = std::enable_if_t<std::is_arithmetic<U>::value>>
+            constexpr RealArrayReference& operator=(const U xi_value) {
+                m_array->m_planes._value[m_index] = static_cast<TYPE>(xi_value);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_array->m_planes._exact[m_index] = static_cast<double>(xi_value);
+                }
+
+                return *this;
+            }
+
+            // numerical assignment (performed on both planes)
+#define M_REFERENCE_ASSIGNMENT_OPERATOR(OP)                                                 \
+            constexpr RealArrayReference& operator OP (const REAL& xi_value) {             \
+                m_array->m_planes._value[m_index] OP xi_value.value();                  \
+                                                                                        \
+                if constexpr (COMPARE == Compare::Yes) {                                \
+                    m_array->m_planes._exact[m_index] OP xi_value.exact();              \
+                }                                                                       \
+                                                                                        \
+                return *this;                                                           \
+            }                                                                           \
+            constexpr RealArrayReference& operator OP (const TYPE xi_value) {              \
+                m_array->m_planes._value[m_index] OP xi_value;                          \
+                                                                                        \
+                if constexpr (COMPARE == Compare::Yes) {                                \
+                    m_array->m_planes._exact[m_index] OP static_cast<double>(xi_value); \
+                }                                                                       \
+                                                                                        \
+                return *this;                                                           \
+            }
+
+            M_REFERENCE_ASSIGNMENT_OPERATOR(+=);
+            M_REFERENCE_ASSIGNMENT_OPERATOR(-=);
+            M_REFERENCE_ASSIGNMENT_OPERATOR(*=);
+            M_REFERENCE_ASSIGNMENT_OPERATOR(/=);
+
+#undef M_REFERENCE_ASSIGNMENT_OPERATOR
+    };
+
+    // an element proxy participates in the expression machinery exactly as the
+    // Real it references (the machinery only touches value()/exact())
+    namespace detail {
+        template<Precision P, Compare C> struct operand_traits<RealArrayReference<P, C>> {
+            static constexpr bool is_real{ true };
+            static constexpr bool is_scalar{ false };
+            static constexpr Precision precision{ P };
+            static constexpr Compare compare{ C };
+        };
+    }
+
+    /**
+    * \brief structure-of-arrays container of Real variables, holding the 'used' values
+    *        and (in comparison mode) the 'exact' values in separate contiguous planes.
+    *
+    * @param {Precision, in} precision of 'used' type (either single or double; single by default)
+    * @param {Compare,   in} should an accuracy comparison be made between single & double precision? (no by default)
+    **/
+    template<Precision PRECISION = Precision::Single, Compare COMPARE = Compare::No> class RealArray {
+        static_assert((COMPARE == Compare::No) || (COMPARE == Compare::Yes),
+                      "RealArray: only Compare::No / Compare::Yes are supported - the planes hold no bound/enclosure/tape lane, so other tracking modes would silently reset on every element round trip.");
+
+        // aliases needed outside this class
+        public:
+            // alias for held element
+            using REAL = Real<PRECISION, COMPARE>;
+
+            // alias for underlying type
+            using TYPE = typename REAL::TYPE;
+
+            // alias for the element proxy
+            using reference = RealArrayReference<PRECISION, COMPARE>;
+
+        // internal structure
+        private:
+            friend reference;
+
+            // planes held when no comparison is performed
+            struct regularPlanes {
+                std::vector<TYPE> _value;   // used values
+            };
+
+            // planes held when a comparison between single and double precision is made
+            struct comparePlanes {
+                std::vector<TYPE> _value;    // used values
+                std::vector<double> _exact;  // 'exact' values (for comparison)
+            };
+
+        // properties
+        private:
+
+            // alias for functional planes
+            using PLANES_TYPE = typename std::conditional<COMPARE == Compare::Yes, comparePlanes, regularPlanes>::type;
+
+            // held planes
+            PLANES_TYPE m_planes;
+
+        // constructor
+        public:
+
+            RealArray() = default;
+
+            explicit RealArray(const std::size_t xi_size) { resize(xi_size); }
+
+            RealArray(const std::size_t xi_size, const REAL& xi_value) {
+                m_planes._value.resize(xi_size, xi_value.value());
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.resize(xi_size, xi_value.exact());
+                }
+            }
+
+            // copy/move semantics
+            RealArray(const RealArray&)                = default;
+            RealArray(RealArray&&) noexcept            = default;
+            RealArray& operator=(const RealArray&)     = default;
+            RealArray& operator=(RealArray&&) noexcept = default;
+
+        // capacity
+        public:
+
+            std::size_t size()  const noexcept { return m_planes._value.size();  }
+            bool        empty() const noexcept { return m_planes._value.empty(); }
+
+            void resize(const std::size_t xi_size) {
+                m_planes._value.resize(xi_size);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.resize(xi_size);
+                }
+            }
+
+            void reserve(const std::size_t xi_capacity) {
+                m_planes._value.reserve(xi_capacity);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.reserve(xi_capacity);
+                }
+            }
+
+            void clear() noexcept {
+                m_planes._value.clear();
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.clear();
+                }
+            }
+
+        // modifiers
+        public:
+
+            void push_back(const REAL& xi_value) {
+                m_planes._value.push_back(xi_value.value());
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.push_back(xi_value.exact());
+                }
+            }
+
+            void push_back(const TYPE xi_value) {
+                m_planes._value.push_back(xi_value);
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_planes._exact.push_back(static_cast<double>(xi_value));
+                }
+            }
+
+        // element access
+        public:
+
+            constexpr reference operator[](const std::size_t xi_index)       { return reference(this, xi_index); }
+            constexpr REAL      operator[](const std::size_t xi_index) const {
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(m_planes._value[xi_index], m_planes._exact[xi_index]);
+                }
+                else {
+                    return REAL(m_planes._value[xi_index]);
+                }
+            }
+
+        // plane accessors
+        public:
+
+            // contiguous plane of 'used' values (cache friendly, vectorizable)
+            std::span<TYPE>       values()       noexcept { return { m_planes._value.data(), m_planes._value.size() }; }
+            std::span<const TYPE> values() const noexcept { return { m_planes._value.data(), m_planes._value.size() }; }
+
+            // contiguous plane of 'exact' values (for comparison)
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            std::span<double>       exacts()       noexcept { return { m_planes._exact.data(), m_planes._exact.size() }; }
+
+            template<Compare T = COMPARE, typename = std::enable_if_t<T == Compare::Yes>>
+            std::span<const double> exacts() const noexcept { return { m_planes._exact.data(), m_planes._exact.size() }; }
+    };
+};
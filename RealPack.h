@@ -0,0 +1,301 @@
+#pragma once
+#include"Real/core.h"
+#include<cstddef>
+
+/**
+* RealPack is a fixed-width batch of Real variables whose arithmetic is performed
+* on all lanes at once.
+*
+* The scalar operators on Real process one lane at a time; in data parallel inner
+* loops that leaves the machine's vector units idle. RealPack keeps N 'used' lanes
+* (and, in comparison mode, N 'exact' shadow lanes) in aligned contiguous storage
+* and implements the arithmetic operators and the standard unary functions as tight
+* per-lane loops over that storage, which the compiler turns into SSE/AVX/NEON code
+* at O2 and above - without tying the header to any specific instruction set.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief a batch of N Real variables, with lane-parallel arithmetic on both
+    *        the 'used' plane and (in comparison mode) the 'exact' plane.
+    *
+    * @param {Precision, in} precision of 'used' type (either single or double; single by default)
+    * @param {Compare,   in} should an accuracy comparison be made between single & double precision? (no by default)
+    * @param {size_t,    in} amount of lanes (8 by default - one AVX register of floats)
+    **/
+    template<Precision PRECISION = Precision::Single, Compare COMPARE = Compare::No, std::size_t N = 8> class RealPack {
+        static_assert(N > 0, "RealPack must hold at least one lane.");
+        static_assert((COMPARE == Compare::No) || (COMPARE == Compare::Yes),
+                      "RealPack: only Compare::No / Compare::Yes are supported - the lanes hold no bound/enclosure/tape lane, so other tracking modes would silently reset on every element round trip.");
+
+        // aliases needed outside this class
+        public:
+            // alias for held element
+            using REAL = Real<PRECISION, COMPARE>;
+
+            // alias for underlying type
+            using TYPE = typename REAL::TYPE;
+
+            // amount of lanes
+            static constexpr std::size_t lanes = N;
+
+        // internal structure
+        private:
+
+            // lanes held when no comparison is performed
+            struct regularLanes {
+                alignas(32) TYPE _value[N];     // used values
+            };
+
+            // lanes held when a comparison between single and double precision is made
+            struct compareLanes {
+                alignas(32) TYPE _value[N];     // used values
+                alignas(32) double _exact[N];   // 'exact' values (for comparison)
+            };
+
+        // properties
+        private:
+
+            // alias for functional lanes
+            using LANES_TYPE = typename std::conditional<COMPARE == Compare::Yes, compareLanes, regularLanes>::type;
+
+            // held lanes
+            LANES_TYPE m_lanes;
+
+        // constructor
+        public:
+
+            constexpr RealPack() : m_lanes() {}
+
+            // broadcast a value to all lanes
+            constexpr RealPack(const TYPE xi_value) {
+                for (std::size_t i{}; i < N; ++i) {
+                    m_lanes._value[i] = xi_value;
+                }
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    for (std::size_t i{}; i < N; ++i) {
+                        m_lanes._exact[i] = static_cast<double>(xi_value);
+                    }
+                }
+            }
+
+            constexpr RealPack(const REAL& xi_value) {
+                for (std::size_t i{}; i < N; ++i) {
+                    m_lanes._value[i] = xi_value.value();
+                }
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    for (std::size_t i{}; i < N; ++i) {
+                        m_lanes._exact[i] = xi_value.exact();
+                    }
+                }
+            }
+
+            // copy/move semantics
+            constexpr RealPack(const RealPack&)                = default;
+            constexpr RealPack(RealPack&&) noexcept            = default;
+            constexpr RealPack& operator=(const RealPack&)     = default;
+            constexpr RealPack& operator=(RealPack&&) noexcept = default;
+
+        // load/store (contiguous planes, e.g. - RealArray's values()/exacts())
+        public:
+
+            // load N 'used' values ('exact' lanes, in comparison mode, are widened from them)
+            static constexpr RealPack load(const TYPE* xi_value) {
+                RealPack out;
+                for (std::size_t i{}; i < N; ++i) {
+                    out.m_lanes._value[i] = xi_value[i];
+                }
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    for (std::size_t i{}; i < N; ++i) {
+                        out.m_lanes._exact[i] = static_cast<double>(xi_value[i]);
+                    }
+                }
+
+                return out;
+            }
+
+            // load N 'used' values and N 'exact' values
+            template<Compare C = COMPARE, typename = std::enable_if_t<C == Compare::Yes>>
+            static constexpr RealPack load(const TYPE* xi_value, const double* xi_exact) {
+                RealPack out;
+                for (std::size_t i{}; i < N; ++i) {
+                    out.m_lanes._value[i] = xi_value[i];
+                }
+                for (std::size_t i{}; i < N; ++i) {
+                    out.m_lanes._exact[i] = xi_exact[i];
+                }
+
+                return out;
+            }
+
+            // store the 'used' lanes
+            constexpr void store(TYPE* xo_value) const {
+                for (std::size_t i{}; i < N; ++i) {
+                    xo_value[i] = m_lanes._value[i];
+                }
+            }
+
+            // store both the 'used' and 'exact' lanes
+            template<Compare C = COMPARE, typename = std::enable_if_t<C == Compare::Yes>>
+            constexpr void store(TYPE* xo_value, double* xo_exact) const {
+                for (std::size_t i{}; i < N; ++i) {
+                    xo_value[i] = m_lanes._value[i];
+                }
+                for (std::size_t i{}; i < N; ++i) {
+                    xo_exact[i] = m_lanes._exact[i];
+                }
+            }
+
+        // getters
+        public:
+
+            // return one lane's 'used' value
+            constexpr TYPE value(const std::size_t xi_lane) const noexcept { return m_lanes._value[xi_lane]; }
+
+            // return one lane's 'exact' value
+            template<Compare C = COMPARE, typename = std::enable_if_t<C == Compare::Yes>>
+            constexpr double exact(const std::size_t xi_lane) const noexcept { return m_lanes._exact[xi_lane]; }
+
+            // materialize one lane as a Real
+            constexpr REAL operator[](const std::size_t xi_lane) const noexcept {
+                if constexpr (COMPARE == Compare::Yes) {
+                    return REAL(m_lanes._value[xi_lane], m_lanes._exact[xi_lane]);
+                }
+                else {
+                    return REAL(m_lanes._value[xi_lane]);
+                }
+            }
+
+            // overwrite one lane
+            constexpr void set(const std::size_t xi_lane, const REAL& xi_value) noexcept {
+                m_lanes._value[xi_lane] = xi_value.value();
+
+                if constexpr (COMPARE == Compare::Yes) {
+                    m_lanes._exact[xi_lane] = xi_value.exact();
+                }
+            }
+
+        // numerical assignment operator overloading (lane parallel)
+        public:
+
+#define M_PACK_ASSIGNMENT_OPERATOR(OP)                                              \
+            constexpr RealPack& operator OP (const RealPack& xi_value) {            \
+                for (std::size_t i{}; i < N; ++i) {                                 \
+                    m_lanes._value[i] OP xi_value.m_lanes._value[i];                \
+                }                                                                   \
+                                                                                    \
+                if constexpr (COMPARE == Compare::Yes) {                            \
+                    for (std::size_t i{}; i < N; ++i) {                             \
+                        m_lanes._exact[i] OP xi_value.m_lanes._exact[i];            \
+                    }                                                               \
+                }                                                                   \
+                                                                                    \
+                return *this;                                                       \
+            }                                                                       \
+            constexpr RealPack& operator OP (const TYPE xi_value) {                 \
+                for (std::size_t i{}; i < N; ++i) {                                 \
+                    m_lanes._value[i] OP xi_value;                                  \
+                }                                                                   \
+                                                                                    \
+                if constexpr (COMPARE == Compare::Yes) {                            \
+                    for (std::size_t i{}; i < N; ++i) {                             \
+                        m_lanes._exact[i] OP static_cast<double>(xi_value);         \
+                    }                                                               \
+                }                                                                   \
+                                                                                    \
+                return *this;                                                       \
+            }
+
+            M_PACK_ASSIGNMENT_OPERATOR(+=);
+            M_PACK_ASSIGNMENT_OPERATOR(-=);
+            M_PACK_ASSIGNMENT_OPERATOR(*=);
+            M_PACK_ASSIGNMENT_OPERATOR(/=);
+
+#undef M_PACK_ASSIGNMENT_OPERATOR
+    };
+
+    // --- unary numerical operator overload ---
+    template<Precision P, Compare C, std::size_t N> constexpr inline RealPack<P, C, N> operator - (const RealPack<P, C, N>& r) {
+        RealPack<P, C, N> out(r);
+        out *= static_cast<typename RealPack<P, C, N>::TYPE>(-1.0);
+        return out;
+    }
+
+    // --- binary numerical operator overload (lane parallel) ---
+#define M_PACK_NUMERICAL_OPERATOR(OP, ASSIGN_OP)                                                                                                                         \
+    template<Precision P, Compare C, std::size_t N> constexpr inline RealPack<P, C, N> operator OP (const RealPack<P, C, N>& xi_lhs, const RealPack<P, C, N>& xi_rhs) {  \
+        RealPack<P, C, N> out(xi_lhs);                                                                                                                                   \
+        out ASSIGN_OP xi_rhs;                                                                                                                                            \
+        return out;                                                                                                                                                      \
+    }                                                                                                                                                                    \
+    template<Precision P, Compare C, std::size_t N> constexpr inline RealPack<P, C, N> operator OP (const RealPack<P, C, N>& xi_lhs, const typename RealPack<P, C, N>::TYPE xi_rhs) { \
+        RealPack<P, C, N> out(xi_lhs);                                                                                                                                   \
+        out ASSIGN_OP xi_rhs;                                                                                                                                            \
+        return out;                                                                                                                                                      \
+    }                                                                                                                                                                    \
+    template<Precision P, Compare C, std::size_t N> constexpr inline RealPack<P, C, N> operator OP (const typename RealPack<P, C, N>::TYPE xi_lhs, const RealPack<P, C, N>& xi_rhs) { \
+        RealPack<P, C, N> out(xi_lhs);                                                                                                                                   \
+        out ASSIGN_OP xi_rhs;                                                                                                                                            \
+        return out;                                                                                                                                                      \
+    }
+
+    M_PACK_NUMERICAL_OPERATOR(+, +=);
+    M_PACK_NUMERICAL_OPERATOR(-, -=);
+    M_PACK_NUMERICAL_OPERATOR(*, *=);
+    M_PACK_NUMERICAL_OPERATOR(/, /=);
+
+#undef M_PACK_NUMERICAL_OPERATOR
+
+    // --- standard unary numerical functions (lane parallel) ---
+#define M_PACK_UNARY_FUNCTION(NAME, OPERATION)                                                                              \
+    template<Precision P, Compare C, std::size_t N> inline RealPack<P, C, N> NAME(const RealPack<P, C, N>& r) noexcept {    \
+        RealPack<P, C, N> out;                                                                                              \
+        for (std::size_t i{}; i < N; ++i) {                                                                                 \
+            if constexpr (C == Compare::Yes) {                                                                              \
+                out.set(i, Real<P, C>(OPERATION(detail::math_arg(r.value(i))), OPERATION(r.exact(i))));                     \
+            }                                                                                                               \
+            else {                                                                                                          \
+                out.set(i, Real<P, C>(OPERATION(detail::math_arg(r.value(i)))));                                            \
+            }                                                                                                               \
+        }                                                                                                                   \
+        return out;                                                                                                         \
+    }
+
+    M_PACK_UNARY_FUNCTION(abs, std::abs);
+    M_PACK_UNARY_FUNCTION(floor, std::floor);
+    M_PACK_UNARY_FUNCTION(ceil, std::ceil);
+    M_PACK_UNARY_FUNCTION(round, std::round);
+    M_PACK_UNARY_FUNCTION(rint, std::rint);
+    M_PACK_UNARY_FUNCTION(trunc, std::trunc);
+    M_PACK_UNARY_FUNCTION(sqrt, std::sqrt);
+    M_PACK_UNARY_FUNCTION(cbrt, std::cbrt);
+    M_PACK_UNARY_FUNCTION(exp, std::exp);
+    M_PACK_UNARY_FUNCTION(exp2, std::exp2);
+    M_PACK_UNARY_FUNCTION(log, std::log);
+    M_PACK_UNARY_FUNCTION(log2, std::log2);
+    M_PACK_UNARY_FUNCTION(log10, std::log10);
+    M_PACK_UNARY_FUNCTION(log1p, std::log1p);
+    M_PACK_UNARY_FUNCTION(sin, std::sin);
+    M_PACK_UNARY_FUNCTION(cos, std::cos);
+    M_PACK_UNARY_FUNCTION(tan, std::tan);
+    M_PACK_UNARY_FUNCTION(asin, std::asin);
+    M_PACK_UNARY_FUNCTION(acos, std::acos);
+    M_PACK_UNARY_FUNCTION(atan, std::atan);
+    M_PACK_UNARY_FUNCTION(sinh, std::sinh);
+    M_PACK_UNARY_FUNCTION(cosh, std::cosh);
+    M_PACK_UNARY_FUNCTION(tanh, std::tanh);
+    M_PACK_UNARY_FUNCTION(asinh, std::asinh);
+    M_PACK_UNARY_FUNCTION(acosh, std::acosh);
+    M_PACK_UNARY_FUNCTION(atanh, std::atanh);
+    M_PACK_UNARY_FUNCTION(erf, std::erf);
+    M_PACK_UNARY_FUNCTION(erfc, std::erfc);
+    M_PACK_UNARY_FUNCTION(tgamma, std::tgamma);
+    M_PACK_UNARY_FUNCTION(lgamma, std::lgamma);
+
+#undef M_PACK_UNARY_FUNCTION
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include"Real/core.h"
+#include"Real/traits.h"
+#include<cstddef>
+#include<span>
+#include<vector>
+
+/**
+* RealSort sorts large buffers of Real's without going through the comparison
+* operators: FP::sort(span) is an LSD radix sort over Real::to_ordered_bits()
+* (the 'used' lane's bit pattern with the sign folded, so integer order of the
+* keys matches floating point order of the values). One byte per pass, whole
+* elements moved - so in every tracking mode the extra lanes ('exact' shadow,
+* bound, enclosure, tape id) travel with their value for free. passes whose key
+* byte is constant over the whole buffer (the common case for the high bytes of
+* clustered data) are skipped outright.
+*
+* On comparison-bound buffers this replaces n*log(n) unpredictable branches with
+* a handful of linear scatter passes.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief sort a contiguous range of Real's in ascending 'used' lane order
+    *
+    * @param {Real*, in} first element of the range
+    * @param {Real*, in} one past the last element of the range
+    **/
+    template<typename REAL> inline void sort(REAL* xi_first, REAL* const xi_last) {
+        static_assert(is_real_v<REAL>, "FP::sort: range must hold Real's");
+        using BITS = decltype(xi_first->to_ordered_bits());
+        constexpr std::size_t PASSES{ sizeof(BITS) };
+
+        const std::size_t len{ static_cast<std::size_t>(xi_last - xi_first) };
+        if (len < 2) {
+            return;
+        }
+
+        // scratch is copy constructed (not default constructed) so modes whose
+        // default constructor has side effects (deferred recording) stay silent
+        std::vector<REAL> scratch(xi_first, xi_last);
+        REAL* src{ xi_first };
+        REAL* dst{ scratch.data() };
+
+        for (std::size_t pass{}; pass < PASSES; ++pass) {
+            const std::size_t shift{ pass * 8 };
+
+            // histogram of this pass' key byte
+            std::size_t offsets[256]{};
+            for (std::size_t i{}; i < len; ++i) {
+                ++offsets[(src[i].to_ordered_bits() >> shift) & 0xFF];
+            }
+
+            // a constant byte permutes nothing - skip the scatter
+            if (offsets[(src[0].to_ordered_bits() >> shift) & 0xFF] == len) {
+                continue;
+            }
+
+            // exclusive prefix sum -> first destination slot per byte value
+            std::size_t running{};
+            for (std::size_t byte{}; byte < 256; ++byte) {
+                const std::size_t count{ offsets[byte] };
+                offsets[byte] = running;
+                running += count;
+            }
+
+            // stable scatter of whole elements
+            for (std::size_t i{}; i < len; ++i) {
+                dst[offsets[(src[i].to_ordered_bits() >> shift) & 0xFF]++] = src[i];
+            }
+
+            std::swap(src, dst);
+        }
+
+        // skipped passes can leave the sorted order in the scratch buffer
+        if (src != xi_first) {
+            for (std::size_t i{}; i < len; ++i) {
+                xi_first[i] = src[i];
+            }
+        }
+    }
+
+    /**
+    * \brief sort a span of Real's in ascending 'used' lane order
+    *
+    * @param {span, in|out} elements, sorted in place
+    **/
+    template<typename REAL> inline void sort(const std::span<REAL> xio_values) {
+        sort(xio_values.data(), xio_values.data() + xio_values.size());
+    }
+};
@@ -0,0 +1,152 @@
+#pragma once
+#include"Real/math.h"
+#include"Real/traits.h"
+#include<cstddef>
+#include<span>
+#include<thread>
+#include<vector>
+
+/**
+* Reduce is the span-level reduction family: FP::reduce (sum), FP::dot and
+* FP::norm2. A sequential '+=' loop has O(n) worst case error growth and one
+* serial dependency chain; these kernels use blocked pairwise summation - eight
+* independent striped accumulators inside each block (so the inner loop
+* vectorizes and fills the FMA pipes), blocks combined as a balanced tree (so
+* the error grows O(log n)) - and split across hardware threads above one
+* million elements, the same threshold ErrorScan uses.
+*
+* In shadow-carrying modes (Compare::Yes / Compare::Trap) the 'exact' lane is
+* reduced alongside the 'used' lane with the same pairwise scheme, so the
+* result's error() reflects the reduction as actually performed. The other
+* tracking modes reduce through their value lane and restart tracking at the
+* result (the per-op machinery cannot see inside a fused kernel).
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    // internal machinery
+    namespace detail {
+
+        // block size of the pairwise tree's leaves
+        constexpr std::size_t REDUCE_BLOCK{ 4096 };
+
+        // pairwise sum of 'xi_term(i)' over [xi_first, xi_first + xi_size): leaves
+        // are 8-striped blocks, inner nodes are one balanced add per pair of halves
+        template<typename ACC, typename TERM_AT> ACC pairwise_sum(const std::size_t xi_first, const std::size_t xi_size, TERM_AT&& xi_term) noexcept {
+            if (xi_size <= REDUCE_BLOCK) {
+                constexpr std::size_t STRIPES{ 8 };
+                ACC sums[STRIPES]{};
+
+                std::size_t i{};
+                for (; (i + STRIPES) <= xi_size; i += STRIPES) {
+                    for (std::size_t s{}; s < STRIPES; ++s) {
+                        sums[s] += xi_term(xi_first + i + s);
+                    }
+                }
+                for (; i < xi_size; ++i) {
+                    sums[0] += xi_term(xi_first + i);
+                }
+
+                return (((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7])));
+            }
+
+            const std::size_t half{ xi_size / 2 };
+            return (pairwise_sum<ACC>(xi_first, half, xi_term) +
+                    pairwise_sum<ACC>(xi_first + half, xi_size - half, xi_term));
+        }
+
+        // pairwise sum, split across hardware threads for large ranges
+        template<typename ACC, typename TERM_AT> ACC pairwise_sum_threaded(const std::size_t xi_size, TERM_AT&& xi_term) noexcept {
+            constexpr std::size_t THREADING_THRESHOLD{ 1'000'000 };
+            const std::size_t worker_count{ (xi_size >= THREADING_THRESHOLD) ? static_cast<std::size_t>(std::thread::hardware_concurrency()) : 1 };
+
+            if (worker_count <= 1) {
+                return pairwise_sum<ACC>(0, xi_size, xi_term);
+            }
+
+            std::vector<ACC> partials(worker_count, ACC{});
+            {
+                std::vector<std::thread> workers;
+                workers.reserve(worker_count);
+                const std::size_t chunk{ xi_size / worker_count };
+
+                for (std::size_t w{}; w < worker_count; ++w) {
+                    const std::size_t first{ w * chunk };
+                    const std::size_t size{ (w + 1 == worker_count) ? (xi_size - first) : chunk };
+                    workers.emplace_back([&partials, w, first, size, &xi_term]() {
+                        partials[w] = pairwise_sum<ACC>(first, size, xi_term);
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            ACC total{};
+            for (const ACC& partial : partials) {
+                total += partial;
+            }
+            return total;
+        }
+
+        // assemble the reduced Real from its reduced lanes (the exact term must be
+        // a generic lambda so modes without an 'exact' lane never instantiate it)
+        template<typename REAL, typename VALUE_AT, typename EXACT_AT>
+        inline REAL reduce_lanes(const std::size_t xi_size, VALUE_AT&& xi_value_term, EXACT_AT&& xi_exact_term) noexcept {
+            using TYPE = typename REAL::TYPE;
+            constexpr Compare C{ operand_traits<REAL>::compare };
+
+            const TYPE value{ pairwise_sum_threaded<TYPE>(xi_size, xi_value_term) };
+            if constexpr ((C == Compare::Yes) || (C == Compare::Trap)) {
+                return REAL(value, pairwise_sum_threaded<double>(xi_size, xi_exact_term));
+            }
+            else {
+                return REAL(value);
+            }
+        }
+    }
+
+    /**
+    * \brief sum of a span of Real's (blocked pairwise; O(log n) error growth)
+    *
+    * @param {span, in}  elements to sum
+    * @param {Real, out} their sum
+    **/
+    template<typename REAL> inline auto reduce(const std::span<REAL> xi_values) noexcept {
+        using RESULT = std::remove_const_t<REAL>;
+        static_assert(is_real_v<RESULT>, "FP::reduce: span must hold Real's");
+
+        return detail::reduce_lanes<RESULT>(xi_values.size(),
+                                            [&xi_values](const std::size_t i) { return xi_values[i].value(); },
+                                            [&xi_values](const auto i) { return detail::exact_of(xi_values[i]); });
+    }
+
+    /**
+    * \brief dot product of two spans of Real's (the smaller extent is processed)
+    *
+    * @param {span, in}  left hand side elements
+    * @param {span, in}  right hand side elements
+    * @param {Real, out} their dot product
+    **/
+    template<typename LHS, typename RHS> inline auto dot(const std::span<LHS> xi_lhs, const std::span<RHS> xi_rhs) noexcept {
+        using RESULT = std::remove_const_t<LHS>;
+        static_assert(is_real_v<RESULT> && std::is_same_v<RESULT, std::remove_const_t<RHS>>,
+                      "FP::dot: both spans must hold the same Real type");
+
+        const std::size_t len{ (xi_lhs.size() < xi_rhs.size()) ? xi_lhs.size() : xi_rhs.size() };
+        return detail::reduce_lanes<RESULT>(len,
+                                            [&xi_lhs, &xi_rhs](const std::size_t i) { return (xi_lhs[i].value() * xi_rhs[i].value()); },
+                                            [&xi_lhs, &xi_rhs](const auto i) { return (detail::exact_of(xi_lhs[i]) * detail::exact_of(xi_rhs[i])); });
+    }
+
+    /**
+    * \brief Euclidean norm of a span of Real's (sqrt of the pairwise sum of squares)
+    *
+    * @param {span, in}  elements
+    * @param {Real, out} their Euclidean norm
+    **/
+    template<typename REAL> inline auto norm2(const std::span<REAL> xi_values) noexcept {
+        return sqrt(dot(xi_values, xi_values));
+    }
+};
@@ -0,0 +1,178 @@
+#pragma once
+#include"Real/core.h"
+#include<cstdio>
+#include<span>
+#include<vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FP_REAL_HAS_MMAP
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+/**
+* Serialize turns checkpointing a buffer of Real's into one write call.
+*
+* Real is trivially copyable (locked in by a static_assert in Real/core.h), so a
+* contiguous range of them is its own wire format: save() writes the raw bytes in
+* one call, load() reads them back into a vector, and - on POSIX systems -
+* load_mapped() maps the checkpoint read-only so restoring 2GB of state costs one
+* mmap instead of a copy. The format is the in-memory layout of Real<P, C>: it is
+* only portable across builds which agree on precision, comparison mode and
+* endianness, which is exactly the checkpoint/restart use case.
+*
+* Dan Israel Malta
+**/
+namespace FP {
+
+    /**
+    * \brief write a contiguous range of Real's into a file, as raw bytes, in one call
+    *
+    * @param {span,  in}  values to write
+    * @param {char*, in}  destination path (overwritten)
+    * @param {bool,  out} true if every byte was written
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    bool save(const std::span<const Real<PRECISION, COMPARE>> xi_values, const char* const xi_path) noexcept {
+        std::FILE* file{ std::fopen(xi_path, "wb") };
+        if (file == nullptr) {
+            return false;
+        }
+
+        const std::size_t written{ std::fwrite(xi_values.data(), sizeof(Real<PRECISION, COMPARE>), xi_values.size(), file) };
+        const bool closed{ std::fclose(file) == 0 };
+        return ((written == xi_values.size()) && closed);
+    }
+
+    /**
+    * \brief read a checkpoint written by save() back into a vector
+    *
+    * @param {char*,  in}  source path
+    * @param {vector, out} restored values (empty on failure or on an empty/torn file)
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    std::vector<Real<PRECISION, COMPARE>> load(const char* const xi_path) {
+        using REAL = Real<PRECISION, COMPARE>;
+
+        std::vector<REAL> values;
+        std::FILE* file{ std::fopen(xi_path, "rb") };
+        if (file == nullptr) {
+            return values;
+        }
+
+        std::fseek(file, 0, SEEK_END);
+        const long bytes{ std::ftell(file) };
+        std::fseek(file, 0, SEEK_SET);
+
+        if ((bytes > 0) && ((static_cast<std::size_t>(bytes) % sizeof(REAL)) == 0)) {
+            values.resize(static_cast<std::size_t>(bytes) / sizeof(REAL));
+            if (std::fread(values.data(), sizeof(REAL), values.size(), file) != values.size()) {
+                values.clear();
+            }
+        }
+
+        std::fclose(file);
+        return values;
+    }
+
+#if defined(FP_REAL_HAS_MMAP)
+
+    /**
+    * \brief a checkpoint mapped read-only into memory; the view() is valid for the
+    *        lifetime of this object (the mapping is released at destruction)
+    **/
+    template<Precision PRECISION, Compare COMPARE> class MappedReals {
+
+        // aliases needed outside this class
+        public:
+            // alias for the mapped element
+            using REAL = Real<PRECISION, COMPARE>;
+
+        // properties
+        private:
+            void* m_base{ nullptr };    // mapping base address (nullptr when empty/failed)
+            std::size_t m_bytes{};      // mapping length, in bytes
+
+        // constructor
+        public:
+
+            constexpr MappedReals() = default;
+            MappedReals(void* const xi_base, const std::size_t xi_bytes) noexcept : m_base(xi_base), m_bytes(xi_bytes) {}
+
+            // a mapping has one owner
+            MappedReals(const MappedReals&)            = delete;
+            MappedReals& operator=(const MappedReals&) = delete;
+
+            MappedReals(MappedReals&& xi_other) noexcept : m_base(xi_other.m_base), m_bytes(xi_other.m_bytes) {
+                xi_other.m_base  = nullptr;
+                xi_other.m_bytes = 0;
+            }
+            MappedReals& operator=(MappedReals&& xi_other) noexcept {
+                if (this != &xi_other) {
+                    release();
+                    m_base           = xi_other.m_base;
+                    m_bytes          = xi_other.m_bytes;
+                    xi_other.m_base  = nullptr;
+                    xi_other.m_bytes = 0;
+                }
+                return *this;
+            }
+
+            ~MappedReals() { release(); }
+
+        // getters
+        public:
+
+            // was the checkpoint mapped successfully?
+            bool valid() const noexcept { return (m_base != nullptr); }
+
+            // the mapped values
+            std::span<const REAL> view() const noexcept {
+                return std::span<const REAL>(static_cast<const REAL*>(m_base), m_bytes / sizeof(REAL));
+            }
+
+        // internal helpers
+        private:
+
+            void release() noexcept {
+                if (m_base != nullptr) {
+                    ::munmap(m_base, m_bytes);
+                    m_base = nullptr;
+                }
+            }
+    };
+
+    /**
+    * \brief map a checkpoint written by save() read-only into memory (no copy)
+    *
+    * @param {char*,       in}  source path
+    * @param {MappedReals, out} mapped view (invalid on failure or on a torn file)
+    **/
+    template<Precision PRECISION, Compare COMPARE>
+    MappedReals<PRECISION, COMPARE> load_mapped(const char* const xi_path) noexcept {
+        using REAL = Real<PRECISION, COMPARE>;
+
+        const int fd{ ::open(xi_path, O_RDONLY) };
+        if (fd < 0) {
+            return {};
+        }
+
+        struct stat status;
+        if ((::fstat(fd, &status) != 0) || (status.st_size <= 0) || ((static_cast<std::size_t>(status.st_size) % sizeof(REAL)) != 0)) {
+            ::close(fd);
+            return {};
+        }
+
+        void* base{ ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0) };
+        ::close(fd);    // the mapping keeps its own reference
+        if (base == MAP_FAILED) {
+            return {};
+        }
+
+        return MappedReals<PRECISION, COMPARE>(base, static_cast<std::size_t>(status.st_size));
+    }
+
+#endif
+};
@@ -0,0 +1,116 @@
+/**
+* benchmark harness for the "zero overhead" claim of Real.h.
+*
+* Real promises no run time / memory cost over raw float or double at O3; this
+* harness proves (or disproves) it per compiler, by running identical kernels -
+* polynomial evaluation (Horner), dot product, and the README's cancellation
+* example - through raw float, raw double, Real<Single>, Real<Double> and
+* Real<Single, Compare::Yes>, and reporting nanoseconds per element for each.
+* A compiler that stops scalarizing the regularStruct wrapper shows up here as
+* Real<Single> drifting away from raw float.
+*
+* build & run:
+*   g++ -std=c++20 -O3 -march=native bench/bench.cpp -o bench_real && ./bench_real
+*
+* Dan Israel Malta
+**/
+#include"../Real.h"
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<vector>
+
+namespace {
+
+    // keep a value (and everything feeding it) alive without a store
+    template<typename T> inline void doNotOptimize(const T& xi_value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(xi_value) : "memory");
+#else
+        volatile T sink{ xi_value };
+        (void)sink;
+#endif
+    }
+
+    // minimal wall time of several runs of 'xi_kernel', in nanoseconds per element
+    template<typename KERNEL> double bench(const std::size_t xi_elements, KERNEL&& xi_kernel) {
+        constexpr int runs{ 7 };
+        double best{ 1.0e300 };
+
+        for (int run{}; run < runs; ++run) {
+            const auto start{ std::chrono::steady_clock::now() };
+            xi_kernel();
+            const auto stop{ std::chrono::steady_clock::now() };
+            const double elapsed{ static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) };
+            if (elapsed < best) {
+                best = elapsed;
+            }
+        }
+
+        return (best / static_cast<double>(xi_elements));
+    }
+
+    // --- kernels (identical source for every element type) ---
+
+    // y[i] = fifth order polynomial of x[i], Horner form
+    template<typename T> void polynomial(const T* xi_x, T* xo_y, const std::size_t xi_size) {
+        for (std::size_t i{}; i < xi_size; ++i) {
+            const T x{ xi_x[i] };
+            T acc(0.25f);
+            acc = acc * x + T(-0.5f);
+            acc = acc * x + T(1.25f);
+            acc = acc * x + T(-2.0f);
+            acc = acc * x + T(0.75f);
+            acc = acc * x + T(3.5f);
+            xo_y[i] = acc;
+        }
+    }
+
+    // sum of x[i] * y[i]
+    template<typename T> T dot(const T* xi_x, const T* xi_y, const std::size_t xi_size) {
+        T acc(0.0f);
+        for (std::size_t i{}; i < xi_size; ++i) {
+            acc += xi_x[i] * xi_y[i];
+        }
+        return acc;
+    }
+
+    // the README's cancellation example, repeated per element
+    template<typename T> T cancellation(const T* xi_x, const std::size_t xi_size) {
+        T acc(0.0f);
+        for (std::size_t i{}; i < xi_size; ++i) {
+            const T c{ xi_x[i] }, d(100.0f);
+            acc += (c + d) * (c - d);
+        }
+        return acc;
+    }
+
+    // run all kernels for one element type and print a row per kernel
+    template<typename T> void benchType(const char* xi_name, const std::size_t xi_size) {
+        std::vector<T> x(xi_size, T(1.5f)), y(xi_size, T(0.5f));
+        for (std::size_t i{}; i < xi_size; ++i) {
+            x[i] = T(100.0f + 0.00001f * static_cast<float>(i % 1000));
+        }
+
+        const double poly{ bench(xi_size, [&] { polynomial(x.data(), y.data(), xi_size); doNotOptimize(y.data()); }) };
+        const double dotp{ bench(xi_size, [&] { doNotOptimize(dot(x.data(), y.data(), xi_size)); }) };
+        const double canc{ bench(xi_size, [&] { doNotOptimize(cancellation(x.data(), xi_size)); }) };
+
+        std::printf("%-28s %12.3f %12.3f %12.3f\n", xi_name, poly, dotp, canc);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t size{ (argc > 1) ? static_cast<std::size_t>(std::atoll(argv[1])) : std::size_t(1) << 22 };
+
+    std::printf("%zu elements, ns/element (lower is better)\n", size);
+    std::printf("%-28s %12s %12s %12s\n", "type", "polynomial", "dot", "cancellation");
+
+    benchType<float>("float", size);
+    benchType<double>("double", size);
+    benchType<FP::Real<FP::Precision::Single>>("Real<Single>", size);
+    benchType<FP::Real<FP::Precision::Double>>("Real<Double>", size);
+    benchType<FP::Real<FP::Precision::Single, FP::Compare::Yes>>("Real<Single, Compare::Yes>", size);
+
+    return 0;
+}